@@ -34,6 +34,7 @@
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/posix/posix-iostream.h"
 #include "common/algorithm.h"
+#include "common/config-manager.h"
 
 #include <sys/param.h>
 #include <sys/stat.h>
@@ -293,6 +294,12 @@ AbstractFSNode *POSIXFilesystemNode::getParent() const {
 }
 
 Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
+	if (ConfMan.getBool("mmap_files")) {
+		Common::SeekableReadStream *stream = MemoryMappedReadStream::makeFromPath(getPath());
+		if (stream)
+			return stream;
+	}
+
 	return PosixIoStream::makeFromPath(getPath(), false);
 }
 
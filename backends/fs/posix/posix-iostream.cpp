@@ -22,14 +22,31 @@
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
 #include "backends/fs/posix/posix-iostream.h"
+#include "common/iostats.h"
 
 #include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(_POSIX_MAPPED_FILES) && _POSIX_MAPPED_FILES > 0
+#include <sys/mman.h>
+#include <setjmp.h>
+#include <signal.h>
+#define USE_POSIX_MMAP
+#endif
 
 #if defined(ANDROID_PLAIN_PORT)
 #include "backends/platform/android/jni-android.h"
-#include <unistd.h>
 #endif
 
+// Files smaller than this are read through stdio, where the mapping
+// overhead isn't worth it.
+#define MMAP_MIN_FILE_SIZE (1024 * 1024)
+
+// On 32-bit builds, files larger than this are read through stdio as well,
+// so that a few big resource files can't exhaust the address space.
+#define MMAP_MAX_FILE_SIZE_32BIT (64 * 1024 * 1024)
+
 
 PosixIoStream *PosixIoStream::makeFromPath(const Common::String &path, bool writeMode) {
 	FILE *handle = fopen(path.c_str(), writeMode ? "wb" : "rb");
@@ -120,3 +137,229 @@ int64 PosixIoStream::size() const {
 
 	return st.st_size;
 }
+
+void PosixIoStream::setAccessPattern(AccessPattern pattern) {
+	StdioStream::setAccessPattern(pattern);
+
+#if defined(POSIX_FADV_NORMAL)
+	int fd = fileno((FILE *)_handle);
+	if (fd == -1)
+		return;
+
+	int advice;
+	switch (pattern) {
+	case kAccessSequential:
+		advice = POSIX_FADV_SEQUENTIAL;
+		break;
+	case kAccessRandom:
+		advice = POSIX_FADV_RANDOM;
+		break;
+	case kAccessNormal:
+	default:
+		advice = POSIX_FADV_NORMAL;
+		break;
+	}
+
+	if (posix_fadvise(fd, 0, 0, advice) == 0)
+		_ioStats.hints++;
+#endif
+}
+
+void PosixIoStream::prefetch(int64 offset, uint32 size) {
+#if defined(POSIX_FADV_WILLNEED)
+	int fd = fileno((FILE *)_handle);
+	if (fd == -1)
+		return;
+
+	if (posix_fadvise(fd, offset, size, POSIX_FADV_WILLNEED) == 0)
+		_ioStats.hints++;
+#endif
+}
+
+#if defined(USE_POSIX_MMAP)
+namespace {
+
+/**
+ * The mapping a thread is currently copying from. Touching a page past the
+ * end of a file that got truncated while it was mapped raises SIGBUS; the
+ * handler below turns that into a read error for the stream doing the copy.
+ */
+struct MappingAccess {
+	const byte *start;
+	const byte *end;
+	sigjmp_buf env;
+};
+
+thread_local MappingAccess *volatile g_mappingAccess = nullptr;
+struct sigaction g_previousSigbusAction;
+
+void mappingSigbusHandler(int sig, siginfo_t *info, void *context) {
+	MappingAccess *access = g_mappingAccess;
+	const byte *addr = (const byte *)info->si_addr;
+	if (access && addr >= access->start && addr < access->end)
+		siglongjmp(access->env, 1);
+
+	// Not a fault in a guarded copy: pass it on to the previous handler,
+	// and keep ours installed.
+	if (g_previousSigbusAction.sa_flags & SA_SIGINFO) {
+		g_previousSigbusAction.sa_sigaction(sig, info, context);
+		return;
+	}
+	if (g_previousSigbusAction.sa_handler != SIG_DFL && g_previousSigbusAction.sa_handler != SIG_IGN) {
+		g_previousSigbusAction.sa_handler(sig);
+		return;
+	}
+
+	// The default action terminates the process, and ignoring the fault
+	// would only repeat it. Restore the default so that the faulting access
+	// repeats and ends the process as it would have without us.
+	signal(SIGBUS, SIG_DFL);
+}
+
+bool installMappingSigbusHandler() {
+	// Installed once and never removed, so every mapped read stays guarded.
+	static bool installed = false;
+	if (installed)
+		return true;
+
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = mappingSigbusHandler;
+	// SA_NODEFER keeps SIGBUS unblocked after jumping out of the handler
+	action.sa_flags = SA_SIGINFO | SA_NODEFER;
+	sigemptyset(&action.sa_mask);
+
+	installed = sigaction(SIGBUS, &action, &g_previousSigbusAction) == 0;
+	return installed;
+}
+
+} // End of anonymous namespace
+#endif
+
+MemoryMappedReadStream *MemoryMappedReadStream::makeFromPath(const Common::String &path) {
+#if defined(USE_POSIX_MMAP)
+	if (!installMappingSigbusHandler())
+		return nullptr;
+
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1)
+		return nullptr;
+
+	struct stat st;
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_size < MMAP_MIN_FILE_SIZE ||
+	        (uint64)st.st_size > 0xFFFFFFFFULL ||
+	        (sizeof(void *) < 8 && st.st_size > MMAP_MAX_FILE_SIZE_32BIT)) {
+		close(fd);
+		return nullptr;
+	}
+
+	void *mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (mapping == MAP_FAILED) {
+		close(fd);
+		return nullptr;
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	close(fd);
+
+	return new MemoryMappedReadStream(mapping, st.st_size);
+#else
+	return nullptr;
+#endif
+}
+
+MemoryMappedReadStream::MemoryMappedReadStream(void *mapping, uint32 size) :
+		Common::MemoryReadStream((const byte *)mapping, size, DisposeAfterUse::NO),
+		_mapping(mapping), _mappingSize(size), _err(false) {
+	_ioStats.opened = 1;
+}
+
+MemoryMappedReadStream::~MemoryMappedReadStream() {
+#if defined(USE_POSIX_MMAP)
+	munmap(_mapping, _mappingSize);
+#endif
+	Common::IOStats::merge(_ioStats);
+}
+
+uint32 MemoryMappedReadStream::read(void *dataPtr, uint32 dataSize) {
+	_ioStats.reads++;
+
+#if defined(USE_POSIX_MMAP)
+	MappingAccess access;
+	access.start = (const byte *)_mapping;
+	access.end = access.start + _mappingSize;
+
+	if (sigsetjmp(access.env, 0)) {
+		// The file shrank under the mapping. The copy is abandoned before
+		// the position is advanced, just like a failed fread().
+		g_mappingAccess = nullptr;
+		_err = true;
+		return 0;
+	}
+
+	g_mappingAccess = &access;
+	const uint32 bytesRead = Common::MemoryReadStream::read(dataPtr, dataSize);
+	g_mappingAccess = nullptr;
+#else
+	const uint32 bytesRead = Common::MemoryReadStream::read(dataPtr, dataSize);
+#endif
+
+	_ioStats.bytesRead += bytesRead;
+	return bytesRead;
+}
+
+const byte *MemoryMappedReadStream::borrow(uint32 dataSize) {
+	// Borrowed data would be read outside of the SIGBUS guard, where a
+	// truncated file can't be caught. Callers fall back to read().
+	return nullptr;
+}
+
+bool MemoryMappedReadStream::seek(int64 offs, int whence) {
+	_ioStats.seeks++;
+
+	if (whence == SEEK_CUR)
+		offs += pos();
+	else if (whence == SEEK_END)
+		offs += size();
+
+	if (offs < 0)
+		return false;
+
+	return Common::MemoryReadStream::seek(MIN<int64>(offs, size()), SEEK_SET);
+}
+
+void MemoryMappedReadStream::setAccessPattern(AccessPattern pattern) {
+#if defined(USE_POSIX_MMAP) && defined(POSIX_MADV_NORMAL)
+	int advice;
+	switch (pattern) {
+	case kAccessSequential:
+		advice = POSIX_MADV_SEQUENTIAL;
+		break;
+	case kAccessRandom:
+		advice = POSIX_MADV_RANDOM;
+		break;
+	case kAccessNormal:
+	default:
+		advice = POSIX_MADV_NORMAL;
+		break;
+	}
+
+	if (posix_madvise(_mapping, _mappingSize, advice) == 0)
+		_ioStats.hints++;
+#endif
+}
+
+void MemoryMappedReadStream::prefetch(int64 offset, uint32 size) {
+#if defined(USE_POSIX_MMAP) && defined(POSIX_MADV_WILLNEED)
+	if (offset < 0 || offset >= _mappingSize)
+		return;
+
+	// madvise() wants a page aligned address
+	const uint32 pageSize = sysconf(_SC_PAGESIZE);
+	const uint32 start = offset - (offset % pageSize);
+	const uint32 length = MIN<uint32>(size, _mappingSize - offset) + (offset - start);
+
+	if (posix_madvise((byte *)_mapping + start, length, POSIX_MADV_WILLNEED) == 0)
+		_ioStats.hints++;
+#endif
+}
@@ -23,6 +23,8 @@
 #define BACKENDS_FS_POSIX_POSIXIOSTREAM_H
 
 #include "backends/fs/stdiostream.h"
+#include "common/iostats.h"
+#include "common/memstream.h"
 
 /**
  * A file input / output stream using POSIX interfaces
@@ -42,6 +44,55 @@ public:
 #endif
 
 	int64 size() const override;
+
+	/** Pass the hints on to the kernel read-ahead via posix_fadvise(), where available. */
+	void setAccessPattern(AccessPattern pattern) override;
+	void prefetch(int64 offset, uint32 size) override;
+};
+
+/**
+ * A read-only file stream over a memory mapped file.
+ *
+ * Reads turn into plain memory copies. A read that runs into a part of
+ * the file truncated since it was mapped fails and sets err() instead of
+ * raising SIGBUS. borrow() is not supported, since the borrowed data would
+ * be accessed outside of that guard.
+ */
+class MemoryMappedReadStream final : public Common::MemoryReadStream {
+public:
+	/**
+	 * Map the file at the given path. Returns nullptr if the file can not be
+	 * mapped, or if its size makes mapping it pointless or impossible, in which
+	 * case the caller should fall back to a regular stream.
+	 */
+	static MemoryMappedReadStream *makeFromPath(const Common::String &path);
+	~MemoryMappedReadStream() override;
+
+	/**
+	 * Unlike MemoryReadStream, tolerate seeking past the end like a stdio
+	 * stream does: the position is clamped to the end of the file.
+	 */
+	bool seek(int64 offs, int whence = SEEK_SET) override;
+
+	uint32 read(void *dataPtr, uint32 dataSize) override;
+	const byte *borrow(uint32 dataSize) override;
+
+	bool err() const override { return _err; }
+	void clearErr() override { _err = false; Common::MemoryReadStream::clearErr(); }
+
+	/** Pass the hints on to the kernel via madvise(), where available. */
+	void setAccessPattern(AccessPattern pattern) override;
+	void prefetch(int64 offset, uint32 size) override;
+
+private:
+	MemoryMappedReadStream(void *mapping, uint32 size);
+
+	void *_mapping;
+	uint32 _mappingSize;
+	bool _err;
+
+	/** Requests handled by this stream, added to Common::IOStats when it is closed. */
+	Common::IOStats::Counters _ioStats;
 };
 
 #endif
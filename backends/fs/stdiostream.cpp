@@ -33,12 +33,17 @@
 #include "backends/platform/sdl/win32/win32_wrapper.h"
 #endif
 
-StdioStream::StdioStream(void *handle) : _handle(handle) {
+// Size of the stdio buffer used for streams read sequentially
+#define SEQUENTIAL_BUFFER_SIZE (64 * 1024)
+
+StdioStream::StdioStream(void *handle) : _handle(handle), _ioStarted(false) {
 	assert(handle);
+	_ioStats.opened = 1;
 }
 
 StdioStream::~StdioStream() {
 	fclose((FILE *)_handle);
+	Common::IOStats::merge(_ioStats);
 }
 
 bool StdioStream::err() const {
@@ -85,6 +90,9 @@ int64 StdioStream::size() const {
 }
 
 bool StdioStream::seek(int64 offs, int whence) {
+	_ioStarted = true;
+	_ioStats.seeks++;
+
 #if defined(WIN32)
 	return _fseeki64((FILE *)_handle, offs, whence) == 0;
 #elif defined(__linux__) || defined(__APPLE__)
@@ -95,7 +103,18 @@ bool StdioStream::seek(int64 offs, int whence) {
 }
 
 uint32 StdioStream::read(void *ptr, uint32 len) {
-	return fread((byte *)ptr, 1, len, (FILE *)_handle);
+	_ioStarted = true;
+
+	uint32 bytesRead = fread((byte *)ptr, 1, len, (FILE *)_handle);
+	_ioStats.reads++;
+	_ioStats.bytesRead += bytesRead;
+	return bytesRead;
+}
+
+void StdioStream::setAccessPattern(AccessPattern pattern) {
+	// setvbuf() may only be called before any other operation on the file
+	if (pattern == kAccessSequential && !_ioStarted)
+		setBufferSize(SEQUENTIAL_BUFFER_SIZE);
 }
 
 bool StdioStream::setBufferSize(uint32 bufferSize) {
@@ -107,6 +126,7 @@ bool StdioStream::setBufferSize(uint32 bufferSize) {
 }
 
 uint32 StdioStream::write(const void *ptr, uint32 len) {
+	_ioStarted = true;
 	return fwrite(ptr, 1, len, (FILE *)_handle);
 }
 
@@ -23,6 +23,7 @@
 #define BACKENDS_FS_STDIOSTREAM_H
 
 #include "common/scummsys.h"
+#include "common/iostats.h"
 #include "common/noncopyable.h"
 #include "common/stream.h"
 #include "common/str.h"
@@ -32,6 +33,12 @@ protected:
 	/** File handle to the actual file. */
 	void *_handle;
 
+	/** Set once the first I/O operation happened, after which the stdio buffer can't be changed. */
+	bool _ioStarted;
+
+	/** Requests handled by this stream, added to Common::IOStats when it is closed. */
+	Common::IOStats::Counters _ioStats;
+
 public:
 	/**
 	 * Given a path, invokes fopen on that path and wrap the result in a
@@ -54,6 +61,12 @@ public:
 	bool seek(int64 offs, int whence = SEEK_SET) override;
 	uint32 read(void *dataPtr, uint32 dataSize) override;
 
+	/**
+	 * Use a larger stdio buffer for sequential access, as long as no I/O
+	 * happened yet.
+	 */
+	void setAccessPattern(AccessPattern pattern) override;
+
 	/**
 	 * Configure buffered IO
 	 *
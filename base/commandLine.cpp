@@ -312,6 +312,9 @@ void registerDefaults() {
 	ConfMan.registerDefault("joystick_num", 0);
 	ConfMan.registerDefault("confirm_exit", false);
 	ConfMan.registerDefault("disable_sdl_parachute", false);
+	// Map large game data files into memory where the filesystem backend
+	// supports it. Opt-in, since it relies on a process-wide SIGBUS handler.
+	ConfMan.registerDefault("mmap_files", false);
 
 	ConfMan.registerDefault("disable_display", false);
 	ConfMan.registerDefault("record_mode", "none");
@@ -37,6 +37,7 @@
 #include "base/version.h"
 
 #include "common/archive.h"
+#include "common/archive-readqueue.h"
 #include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/debug-channels.h" /* for debug manager */
@@ -723,6 +724,7 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	Common::ConfigManager::destroy();
 	Common::DebugManager::destroy();
 	Common::OSDMessageQueue::destroy();
+	Common::ArchiveReadQueue::destroy();
 #ifdef ENABLE_EVENTRECORDER
 	GUI::EventRecorder::destroy();
 #endif
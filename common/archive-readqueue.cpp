@@ -0,0 +1,197 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/archive-readqueue.h"
+#include "common/debug.h"
+#include "common/memstream.h"
+#include "common/system.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(ArchiveReadQueue);
+
+ArchiveReadRequest::ArchiveReadRequest(Archive *archive, const Path &member, ArchiveReadCallback *callback) :
+	_archive(archive), _member(member), _callback(callback), _state(kStatePending),
+	_stream(nullptr), _data(nullptr), _size(0), _loaded(0) {
+}
+
+ArchiveReadRequest::~ArchiveReadRequest() {
+	discard();
+}
+
+void ArchiveReadRequest::discard() {
+	delete _stream;
+	_stream = nullptr;
+	free(_data);
+	_data = nullptr;
+	_size = 0;
+	_loaded = 0;
+}
+
+ArchiveReadQueue::ArchiveReadQueue() : _observerRegistered(false) {
+}
+
+ArchiveReadQueue::~ArchiveReadQueue() {
+	if (_observerRegistered)
+		g_system->getEventManager()->getEventDispatcher()->unregisterObserver(this);
+}
+
+void ArchiveReadQueue::registerObserver() {
+	if (_observerRegistered)
+		return;
+
+	Common::EventManager *manager = g_system->getEventManager();
+	if (!manager)
+		return;
+
+	// The lowest priority: the queue never eats events, it only needs the polls
+	manager->getEventDispatcher()->registerObserver(this, 0, false, true);
+	_observerRegistered = true;
+}
+
+ArchiveReadRequestPtr ArchiveReadQueue::submit(Archive *archive, const Path &member, ArchiveReadCallback *callback) {
+	assert(archive);
+
+	ArchiveReadRequestPtr request(new ArchiveReadRequest(archive, member, callback));
+	_pending.push_back(request);
+
+	registerObserver();
+	return request;
+}
+
+void ArchiveReadQueue::submit(Archive *archive, const Array<Path> &members, Array<ArchiveReadRequestPtr> &requests) {
+	assert(archive);
+
+	for (uint i = 0; i < members.size(); ++i) {
+		ArchiveReadRequestPtr request(new ArchiveReadRequest(archive, members[i], nullptr));
+		_pending.push_back(request);
+		requests.push_back(request);
+	}
+
+	registerObserver();
+}
+
+bool ArchiveReadQueue::handle() {
+	if (_pending.empty())
+		return false;
+
+	ArchiveReadRequestPtr request = _pending.front();
+	const uint32 start = g_system->getMillis();
+	do {
+		if (loadChunk(*request)) {
+			_pending.pop_front();
+			finish(*request);
+			break;
+		}
+	} while (g_system->getMillis() - start < kLoadBudgetMillis);
+
+	return true;
+}
+
+bool ArchiveReadQueue::loadChunk(ArchiveReadRequest &request) {
+	if (request._state == ArchiveReadRequest::kStatePending) {
+		request._state = ArchiveReadRequest::kStateLoading;
+		request._stream = request._archive->createReadStreamForMember(request._member);
+
+		const int64 size = request._stream ? request._stream->size() : -1;
+		if (size >= 0 && size <= 0xFFFFFFFF) {
+			request._data = (byte *)malloc(MAX<int64>(size, 1));
+			request._size = size;
+		}
+		if (!request._data) {
+			debug(1, "ArchiveReadQueue: Failed to open '%s'", request._member.toString().c_str());
+			request.discard();
+			request._state = ArchiveReadRequest::kStateFailed;
+			return true;
+		}
+	}
+
+	const uint32 chunk = MIN(request._size - request._loaded, kChunkSize);
+	if (request._stream->read(request._data + request._loaded, chunk) != chunk || request._stream->err()) {
+		debug(1, "ArchiveReadQueue: Failed to read '%s'", request._member.toString().c_str());
+		request.discard();
+		request._state = ArchiveReadRequest::kStateFailed;
+		return true;
+	}
+
+	request._loaded += chunk;
+	if (request._loaded < request._size)
+		return false;
+
+	delete request._stream;
+	request._stream = nullptr;
+	request._state = ArchiveReadRequest::kStateDone;
+	return true;
+}
+
+void ArchiveReadQueue::load(ArchiveReadRequest &request) {
+	while (!loadChunk(request)) {
+	}
+}
+
+void ArchiveReadQueue::finish(ArchiveReadRequest &request) {
+	if (request._callback)
+		(*request._callback)(&request);
+}
+
+SeekableReadStream *ArchiveReadQueue::takeStream(const ArchiveReadRequestPtr &request) {
+	if (request->_state == ArchiveReadRequest::kStatePending || request->_state == ArchiveReadRequest::kStateLoading) {
+		// Not finished yet, so load the rest right away
+		_pending.remove(request);
+		load(*request);
+		finish(*request);
+	}
+
+	if (request->_state != ArchiveReadRequest::kStateDone || !request->_data)
+		return nullptr;
+
+	SeekableReadStream *stream = new MemoryReadStream(request->_data, request->_size, DisposeAfterUse::YES);
+	request->_data = nullptr;
+	return stream;
+}
+
+ArchiveReadRequest::State ArchiveReadQueue::getState(const ArchiveReadRequestPtr &request) const {
+	return request->_state;
+}
+
+void ArchiveReadQueue::cancel(const ArchiveReadRequestPtr &request) {
+	if (request->_state == ArchiveReadRequest::kStatePending || request->_state == ArchiveReadRequest::kStateLoading) {
+		_pending.remove(request);
+		request->discard();
+		request->_state = ArchiveReadRequest::kStateCancelled;
+	}
+}
+
+void ArchiveReadQueue::cancelAll(Archive *archive) {
+	for (List<ArchiveReadRequestPtr>::iterator i = _pending.begin(); i != _pending.end();) {
+		if ((*i)->_archive == archive) {
+			// Partially loaded requests hold a stream into the archive
+			(*i)->discard();
+			(*i)->_state = ArchiveReadRequest::kStateCancelled;
+			i = _pending.erase(i);
+		} else {
+			++i;
+		}
+	}
+}
+
+} // End of namespace Common
@@ -0,0 +1,193 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef COMMON_ARCHIVE_READQUEUE_H
+#define COMMON_ARCHIVE_READQUEUE_H
+
+#include "common/archive.h"
+#include "common/callback.h"
+#include "common/events.h"
+#include "common/list.h"
+#include "common/path.h"
+#include "common/ptr.h"
+#include "common/singleton.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_archive_readqueue Archive read queue
+ * @ingroup common_arch
+ *
+ * @brief API for loading archive members ahead of time, while the engine is idle.
+ * @{
+ */
+
+class ArchiveReadRequest;
+
+typedef SharedPtr<ArchiveReadRequest> ArchiveReadRequestPtr;
+typedef BaseCallback<ArchiveReadRequest *> ArchiveReadCallback;
+
+/**
+ * A single archive member load, submitted to the ArchiveReadQueue.
+ */
+class ArchiveReadRequest {
+public:
+	enum State {
+		kStatePending,   ///< Waiting in the queue
+		kStateLoading,   ///< Partially loaded
+		kStateDone,      ///< Loaded, the data can be taken with ArchiveReadQueue::takeStream()
+		kStateFailed,    ///< The member could not be read
+		kStateCancelled  ///< Removed from the queue before being loaded
+	};
+
+	~ArchiveReadRequest();
+
+	Archive *getArchive() const { return _archive; }
+	const Path &getMember() const { return _member; }
+
+	/** Size of the loaded data, only meaningful once the request is done. */
+	uint32 getSize() const { return _size; }
+
+private:
+	friend class ArchiveReadQueue;
+
+	ArchiveReadRequest(Archive *archive, const Path &member, ArchiveReadCallback *callback);
+
+	/** Drop the member stream and any data read so far. */
+	void discard();
+
+	Archive *_archive;
+	Path _member;
+	ScopedPtr<ArchiveReadCallback> _callback;
+
+	State _state;
+	SeekableReadStream *_stream;
+	byte *_data;
+	uint32 _size;
+	uint32 _loaded;
+};
+
+/**
+ * Queue of archive members to be loaded ahead of time.
+ *
+ * Engines can submit the resources they are going to need soon, e.g. those
+ * of the next room, and pick up the loaded data later with takeStream(),
+ * which loads whatever is still missing right away.
+ *
+ * Loading is deferred, not asynchronous: it happens on the engine's thread,
+ * in submission order. Each time the engine polls for events, the request
+ * at the front of the queue is read in chunks for at most
+ * kLoadBudgetMillis. This spreads the loading over the frames the engine
+ * spends waiting anyway, e.g. while fading out the current room, without
+ * touching the archive from another thread. Opening a member is not split
+ * up, so archives which decompress members when opening them still do that
+ * in one go.
+ *
+ * @note The queue is not thread safe: it must only be used from the thread
+ * running the engine's main loop.
+ */
+class ArchiveReadQueue : public Singleton<ArchiveReadQueue>, private EventObserver {
+public:
+	~ArchiveReadQueue();
+
+	/**
+	 * Queue loading the given archive member.
+	 *
+	 * @param archive	Archive containing the member. Must stay valid until
+	 *                  the request is finished or cancelled.
+	 * @param member	Path of the member in the archive.
+	 * @param callback	Optional callback, called once the request is done or
+	 *                  failed. The request takes ownership of it.
+	 *
+	 * @return The request, to be passed to takeStream() or cancel().
+	 */
+	ArchiveReadRequestPtr submit(Archive *archive, const Path &member, ArchiveReadCallback *callback = nullptr);
+
+	/**
+	 * Queue loading a batch of members from the same archive.
+	 * The requests are appended to @p requests, in the order of @p members.
+	 */
+	void submit(Archive *archive, const Array<Path> &members, Array<ArchiveReadRequestPtr> &requests);
+
+	/**
+	 * Get the data of a request as a stream. A request which is still pending
+	 * or partially loaded is finished right away.
+	 *
+	 * The data is handed over to the stream, so this can only be called once
+	 * per request.
+	 *
+	 * @return A stream over the member data, or nullptr if the request failed
+	 *         or was cancelled.
+	 */
+	SeekableReadStream *takeStream(const ArchiveReadRequestPtr &request);
+
+	/** Get the current state of a request. */
+	ArchiveReadRequest::State getState(const ArchiveReadRequestPtr &request) const;
+
+	/** Remove a request from the queue if it has not been fully loaded yet. */
+	void cancel(const ArchiveReadRequestPtr &request);
+
+	/**
+	 * Cancel all pending requests for the given archive. Must be called
+	 * before deleting an archive which still has requests queued.
+	 */
+	void cancelAll(Archive *archive);
+
+	/**
+	 * Continue loading the request at the front of the queue, for at most
+	 * kLoadBudgetMillis. Called whenever the engine polls for events, but can
+	 * also be used to make progress from other idle time.
+	 *
+	 * @return True if there was a request to work on.
+	 */
+	bool handle();
+
+	/** Time handle() may spend reading, in milliseconds. */
+	static const uint32 kLoadBudgetMillis = 2;
+	/** Amount of data read at once. */
+	static const uint32 kChunkSize = 64 * 1024;
+
+private:
+	friend class Singleton<SingletonBaseType>;
+	ArchiveReadQueue();
+
+	// EventObserver API
+	bool notifyEvent(const Event &event) override { return false; }
+	void notifyPoll() override { handle(); }
+
+	void registerObserver();
+	bool loadChunk(ArchiveReadRequest &request);
+	void load(ArchiveReadRequest &request);
+	void finish(ArchiveReadRequest &request);
+
+	List<ArchiveReadRequestPtr> _pending;
+	bool _observerRegistered;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+/** Shortcut for accessing the archive read queue. */
+#define ArchiveReadMan Common::ArchiveReadQueue::instance()
+
+#endif
@@ -144,6 +144,14 @@ public:
 			insert_aux(end(), &element, &element + 1);
 	}
 
+	/** Append an element to the end of the array, moving it into place if there is room for it. */
+	void push_back(T &&element) {
+		if (_size + 1 <= _capacity)
+			new ((void *)&_storage[_size++]) T(static_cast<T &&>(element));
+		else
+			insert_aux(end(), &element, &element + 1);
+	}
+
 	/** Append an element to the end of the array. */
 	void push_back(const Array<T> &array) {
 		if (_size + array.size() <= _capacity) {
@@ -142,6 +142,21 @@ uint32 File::read(void *ptr, uint32 len) {
 	return _handle->read(ptr, len);
 }
 
+const byte *File::borrow(uint32 dataSize) {
+	assert(_handle);
+	return _handle->borrow(dataSize);
+}
+
+void File::setAccessPattern(AccessPattern pattern) {
+	assert(_handle);
+	_handle->setAccessPattern(pattern);
+}
+
+void File::prefetch(int64 offset, uint32 size) {
+	assert(_handle);
+	_handle->prefetch(offset, size);
+}
+
 
 DumpFile::DumpFile() : _handle(nullptr) {
 }
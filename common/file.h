@@ -133,6 +133,10 @@ public:
 	int64 size() const override; /*!< Implement abstract SeekableReadStream method. */
 	bool seek(int64 offs, int whence = SEEK_SET) override;	/*!< Implement abstract SeekableReadStream method. */
 	uint32 read(void *dataPtr, uint32 dataSize) override;	/*!< Implement abstract SeekableReadStream method. */
+	const byte *borrow(uint32 dataSize) override;	/*!< Forward to the underlying stream. */
+
+	void setAccessPattern(AccessPattern pattern) override;	/*!< Forward the hint to the underlying stream. */
+	void prefetch(int64 offset, uint32 size) override;	/*!< Forward the hint to the underlying stream. */
 };
 
 
@@ -0,0 +1,56 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/iostats.h"
+#include "common/mutex.h"
+
+namespace Common {
+
+static IOStats::Counters g_ioStats;
+
+static Mutex &getIOStatsMutex() {
+	// Created on first use, once the backend exists, and never destroyed so
+	// that streams closed during shutdown can still be counted.
+	static Mutex *mutex = new Mutex();
+	return *mutex;
+}
+
+IOStats::Counters IOStats::get() {
+	StackLock lock(getIOStatsMutex());
+	return g_ioStats;
+}
+
+void IOStats::reset() {
+	StackLock lock(getIOStatsMutex());
+	g_ioStats = Counters();
+}
+
+void IOStats::merge(const Counters &counters) {
+	StackLock lock(getIOStatsMutex());
+	g_ioStats.opened += counters.opened;
+	g_ioStats.reads += counters.reads;
+	g_ioStats.seeks += counters.seeks;
+	g_ioStats.hints += counters.hints;
+	g_ioStats.bytesRead += counters.bytesRead;
+}
+
+} // End of namespace Common
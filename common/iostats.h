@@ -0,0 +1,71 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef COMMON_IOSTATS_H
+#define COMMON_IOSTATS_H
+
+#include "common/scummsys.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_iostats I/O statistics
+ * @ingroup common
+ *
+ * @brief Process-wide counters of the file I/O requests handled by the backend streams.
+ * @{
+ */
+
+/**
+ * Counters of the requests handled by the file streams of the backend.
+ * Useful to compare the I/O behaviour of engines before and after a change.
+ *
+ * Each stream counts its own requests without any locking, and adds its
+ * totals here when it is closed. Streams that are still open are not
+ * included yet.
+ */
+class IOStats {
+public:
+	struct Counters {
+		uint32 opened;    ///< Number of streams opened
+		uint32 reads;     ///< Number of read() calls
+		uint32 seeks;     ///< Number of seek() calls
+		uint32 hints;     ///< Number of access hints passed on to the OS
+		uint64 bytesRead; ///< Total number of bytes read
+
+		Counters() : opened(0), reads(0), seeks(0), hints(0), bytesRead(0) {}
+	};
+
+	/** Return a snapshot of the totals of the closed streams. */
+	static Counters get();
+	/** Set all totals back to zero. */
+	static void reset();
+
+	/** Add the counters of a stream which is being closed. May be called from any thread. */
+	static void merge(const Counters &counters);
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -70,6 +70,7 @@ public:
 	}
 
 	uint32 read(void *dataPtr, uint32 dataSize);
+	const byte *borrow(uint32 dataSize);
 
 	bool eos() const { return _eos; }
 	void clearErr() { _eos = false; }
@@ -98,6 +99,154 @@ public:
 	bool skip(uint32 offset) override { return MemoryReadStream::seek(offset, SEEK_CUR); }
 };
 
+/**
+ * Lightweight reader over a plain memory block, with inlined endian and
+ * bulk read methods.
+ *
+ * This is meant for parsing data borrowed from a stream via
+ * ReadStream::borrow(): unlike a MemoryReadStream, none of its methods
+ * are virtual, so reading a value compiles down to a bounds check and
+ * a load.
+ *
+ * Reading past the end of the block sets the end-of-data flag, and
+ * yields zero for the missing data.
+ */
+class MemoryReader {
+private:
+	const byte *_ptr;
+	uint32 _size;
+	uint32 _pos;
+	bool _eos;
+
+	const byte *take(uint32 dataSize) {
+		if (dataSize > _size - _pos) {
+			_pos = _size;
+			_eos = true;
+			return nullptr;
+		}
+		const byte *ptr = _ptr + _pos;
+		_pos += dataSize;
+		return ptr;
+	}
+
+	const byte *takeArray(uint32 count, uint32 elementSize) {
+		if (count > remaining() / elementSize) {
+			_pos = _size;
+			_eos = true;
+			return nullptr;
+		}
+		return take(count * elementSize);
+	}
+
+public:
+	MemoryReader(const byte *dataPtr, uint32 dataSize) : _ptr(dataPtr), _size(dataPtr ? dataSize : 0), _pos(0), _eos(false) {}
+
+	const byte *getData() const { return _ptr; }
+	uint32 pos() const { return _pos; }
+	uint32 size() const { return _size; }
+	uint32 remaining() const { return _size - _pos; }
+	bool eos() const { return _eos; }
+
+	void seek(uint32 offset) { _pos = MIN(offset, _size); _eos = false; }
+	void skip(uint32 offset) { take(offset); }
+
+	byte readByte() {
+		const byte *ptr = take(1);
+		return ptr ? *ptr : 0;
+	}
+	int8 readSByte() { return (int8)readByte(); }
+
+	uint16 readUint16LE() {
+		const byte *ptr = take(2);
+		return ptr ? READ_LE_UINT16(ptr) : 0;
+	}
+	uint16 readUint16BE() {
+		const byte *ptr = take(2);
+		return ptr ? READ_BE_UINT16(ptr) : 0;
+	}
+	uint32 readUint32LE() {
+		const byte *ptr = take(4);
+		return ptr ? READ_LE_UINT32(ptr) : 0;
+	}
+	uint32 readUint32BE() {
+		const byte *ptr = take(4);
+		return ptr ? READ_BE_UINT32(ptr) : 0;
+	}
+	int16 readSint16LE() { return (int16)readUint16LE(); }
+	int16 readSint16BE() { return (int16)readUint16BE(); }
+	int32 readSint32LE() { return (int32)readUint32LE(); }
+	int32 readSint32BE() { return (int32)readUint32BE(); }
+
+	/**
+	 * Copy @p dataSize bytes into @p dataPtr.
+	 * @return The number of bytes that were actually copied.
+	 */
+	uint32 read(void *dataPtr, uint32 dataSize) {
+		if (dataSize > remaining()) {
+			dataSize = remaining();
+			_eos = true;
+		}
+		memcpy(dataPtr, _ptr + _pos, dataSize);
+		_pos += dataSize;
+		return dataSize;
+	}
+
+	/**
+	 * Bulk read @p count values of the given endianness into @p dst.
+	 * If the block holds fewer values, nothing is read and the
+	 * end-of-data flag is set.
+	 * @return True on success.
+	 */
+	bool readUint16LEArray(uint16 *dst, uint32 count) {
+		const byte *ptr = takeArray(count, 2);
+		if (!ptr)
+			return false;
+#ifdef SCUMM_LITTLE_ENDIAN
+		memcpy(dst, ptr, count * 2);
+#else
+		for (uint32 i = 0; i < count; ++i, ptr += 2)
+			dst[i] = READ_LE_UINT16(ptr);
+#endif
+		return true;
+	}
+	bool readUint16BEArray(uint16 *dst, uint32 count) {
+		const byte *ptr = takeArray(count, 2);
+		if (!ptr)
+			return false;
+#ifdef SCUMM_BIG_ENDIAN
+		memcpy(dst, ptr, count * 2);
+#else
+		for (uint32 i = 0; i < count; ++i, ptr += 2)
+			dst[i] = READ_BE_UINT16(ptr);
+#endif
+		return true;
+	}
+	bool readUint32LEArray(uint32 *dst, uint32 count) {
+		const byte *ptr = takeArray(count, 4);
+		if (!ptr)
+			return false;
+#ifdef SCUMM_LITTLE_ENDIAN
+		memcpy(dst, ptr, count * 4);
+#else
+		for (uint32 i = 0; i < count; ++i, ptr += 4)
+			dst[i] = READ_LE_UINT32(ptr);
+#endif
+		return true;
+	}
+	bool readUint32BEArray(uint32 *dst, uint32 count) {
+		const byte *ptr = takeArray(count, 4);
+		if (!ptr)
+			return false;
+#ifdef SCUMM_BIG_ENDIAN
+		memcpy(dst, ptr, count * 4);
+#else
+		for (uint32 i = 0; i < count; ++i, ptr += 4)
+			dst[i] = READ_BE_UINT32(ptr);
+#endif
+		return true;
+	}
+};
+
 /**
  * Simple memory based 'stream', which implements the WriteStream interface for
  * a plain memory block.
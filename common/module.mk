@@ -3,6 +3,7 @@ MODULE := common
 MODULE_OBJS := \
 	achievements.o \
 	archive.o \
+	archive-readqueue.o \
 	base-str.o \
 	config-manager.o \
 	coroutines.o \
@@ -18,6 +19,7 @@ MODULE_OBJS := \
 	ini-file.o \
 	installshield_cab.o \
 	installshieldv3_archive.o \
+	iostats.o \
 	json.o \
 	language.o \
 	localization.o \
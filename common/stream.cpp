@@ -107,6 +107,17 @@ uint32 MemoryReadStream::read(void *dataPtr, uint32 dataSize) {
 	return dataSize;
 }
 
+const byte *MemoryReadStream::borrow(uint32 dataSize) {
+	if (dataSize > _size - _pos)
+		return nullptr;
+
+	const byte *ptr = _ptr;
+	_ptr += dataSize;
+	_pos += dataSize;
+
+	return ptr;
+}
+
 bool MemoryReadStream::seek(int64 offs, int whence) {
 	// Pre-Condition
 	assert(_pos <= _size);
@@ -234,6 +245,17 @@ uint32 SubReadStream::read(void *dataPtr, uint32 dataSize) {
 	return dataSize;
 }
 
+const byte *SubReadStream::borrow(uint32 dataSize) {
+	if (dataSize > _end - _pos)
+		return nullptr;
+
+	const byte *ptr = _parentStream->borrow(dataSize);
+	if (ptr)
+		_pos += dataSize;
+
+	return ptr;
+}
+
 SeekableSubReadStream::SeekableSubReadStream(SeekableReadStream *parentStream, uint32 begin, uint32 end, DisposeAfterUse::Flag disposeParentStream)
 	: SubReadStream(parentStream, end, disposeParentStream),
 	_parentStream(parentStream),
@@ -270,6 +292,13 @@ bool SeekableSubReadStream::seek(int64 offset, int whence) {
 	return ret;
 }
 
+void SeekableSubReadStream::prefetch(int64 offset, uint32 size) {
+	if (offset < 0 || offset >= _end - _begin)
+		return;
+
+	_parentStream->prefetch(_begin + offset, MIN<int64>(size, _end - _begin - offset));
+}
+
 uint32 SafeSeekableSubReadStream::read(void *dataPtr, uint32 dataSize) {
 	// Make sure the parent stream is at the right position
 	seek(0, SEEK_CUR);
@@ -277,6 +306,13 @@ uint32 SafeSeekableSubReadStream::read(void *dataPtr, uint32 dataSize) {
 	return SeekableSubReadStream::read(dataPtr, dataSize);
 }
 
+const byte *SafeSeekableSubReadStream::borrow(uint32 dataSize) {
+	// Make sure the parent stream is at the right position
+	seek(0, SEEK_CUR);
+
+	return SeekableSubReadStream::borrow(dataSize);
+}
+
 void SeekableReadStream::hexdump(int len, int bytesPerLine, int startOffset) {
 	uint pos_ = pos();
 	uint size_ = size();
@@ -318,6 +354,7 @@ public:
 	void clearErr() override { _eos = false; _parentStream->clearErr(); }
 
 	uint32 read(void *dataPtr, uint32 dataSize) override;
+	const byte *borrow(uint32 dataSize) override;
 };
 
 BufferedReadStream::BufferedReadStream(ReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream)
@@ -392,6 +429,29 @@ uint32 BufferedReadStream::read(void *dataPtr, uint32 dataSize) {
 	return alreadyRead + dataSize;
 }
 
+const byte *BufferedReadStream::borrow(uint32 dataSize) {
+	const uint32 bufBytesLeft = _bufSize - _pos;
+
+	if (dataSize > bufBytesLeft) {
+		if (dataSize > _realBufSize)
+			return nullptr;
+
+		// Move the unread data to the front of the buffer and top it up.
+		// The buffer still ends at the parent stream position afterwards,
+		// so seeking back into it keeps working.
+		memmove(_buf, _buf + _pos, bufBytesLeft);
+		_bufSize = bufBytesLeft + _parentStream->read(_buf + bufBytesLeft, _realBufSize - bufBytesLeft);
+		_pos = 0;
+
+		if (dataSize > _bufSize)
+			return nullptr;
+	}
+
+	const byte *ptr = _buf + _pos;
+	_pos += dataSize;
+	return ptr;
+}
+
 } // End of anonymous namespace
 
 
@@ -419,6 +479,9 @@ public:
 	int64 size() const override { return _parentStream->size(); }
 
 	bool seek(int64 offset, int whence = SEEK_SET) override;
+
+	void setAccessPattern(AccessPattern pattern) override { _parentStream->setAccessPattern(pattern); }
+	void prefetch(int64 offset, uint32 size) override { _parentStream->prefetch(offset, size); }
 };
 
 BufferedSeekableReadStream::BufferedSeekableReadStream(SeekableReadStream *parentStream, uint32 bufSize, DisposeAfterUse::Flag disposeParentStream)
@@ -368,6 +368,29 @@ public:
 	 */
 	virtual uint32 read(void *dataPtr, uint32 dataSize) = 0;
 
+	/**
+	 * Borrow data from the stream without copying it.
+	 *
+	 * Streams that keep their data in memory can return a pointer directly
+	 * into their storage instead of copying it into a caller-supplied buffer.
+	 * On success, the stream position is advanced past the borrowed bytes,
+	 * exactly as if they had been read with read().
+	 *
+	 * The returned pointer stays valid until the next read, seek or borrow
+	 * call on the stream, or until the stream is destroyed, whichever
+	 * comes first.
+	 *
+	 * @note Borrowing is an optional optimization. Callers must be prepared
+	 * to fall back to read() when it fails.
+	 *
+	 * @param dataSize	Number of bytes to borrow.
+	 *
+	 * @return Pointer to @p dataSize bytes of stream data, or nullptr if the
+	 *         stream can not provide them directly. In that case, the stream
+	 *         position and the end-of-stream flag are left unchanged.
+	 */
+	virtual const byte *borrow(uint32 dataSize) { return nullptr; }
+
 	/**
 	 * @name Functions for reading data
 	 *
@@ -663,6 +686,12 @@ public:
  */
 class SeekableReadStream : virtual public ReadStream {
 public:
+	/** Access pattern hints, see setAccessPattern(). */
+	enum AccessPattern {
+		kAccessNormal,     /*!< No particular access pattern. */
+		kAccessSequential, /*!< Data is mostly read front to back. */
+		kAccessRandom      /*!< Data is read in small chunks at scattered offsets. */
+	};
 
 	/**
 	 * Obtain the current value of the stream position indicator.
@@ -711,6 +740,27 @@ public:
 	 */
 	virtual bool skip(uint32 offset) { return seek(offset, SEEK_CUR); }
 
+	/**
+	 * Hint at how the stream is going to be accessed.
+	 *
+	 * Streams backed by slow storage can use this to tune their read-ahead.
+	 * This is purely advisory and never changes the data read from the stream.
+	 *
+	 * @param pattern	Expected access pattern.
+	 */
+	virtual void setAccessPattern(AccessPattern pattern) {}
+
+	/**
+	 * Hint that the given range of the stream is going to be read soon,
+	 * so that it can be fetched ahead of time.
+	 *
+	 * This is purely advisory and does not change the stream position.
+	 *
+	 * @param offset	Start of the range, relative to the start of the stream.
+	 * @param size		Size of the range in bytes.
+	 */
+	virtual void prefetch(int64 offset, uint32 size) {}
+
 	/**
 	 * Read at most one less than the number of characters specified
 	 * by @p bufSize from the stream and store them in the string buffer.
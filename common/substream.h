@@ -64,6 +64,7 @@ public:
 	virtual bool err() const { return _parentStream->err(); }
 	virtual void clearErr() { _eos = false; _parentStream->clearErr(); }
 	virtual uint32 read(void *dataPtr, uint32 dataSize);
+	virtual const byte *borrow(uint32 dataSize);
 };
 
 /*
@@ -85,6 +86,9 @@ public:
 	virtual int64 size() const { return _end - _begin; }
 
 	virtual bool seek(int64 offset, int whence = SEEK_SET);
+
+	virtual void setAccessPattern(AccessPattern pattern) { _parentStream->setAccessPattern(pattern); }
+	virtual void prefetch(int64 offset, uint32 size);
 };
 
 /**
@@ -130,6 +134,7 @@ public:
 	}
 
 	virtual uint32 read(void *dataPtr, uint32 dataSize);
+	virtual const byte *borrow(uint32 dataSize);
 };
 
 /** @} */
@@ -25,6 +25,10 @@
 #include "ags/shared/ac/sprite_cache.h"
 #include "ags/shared/gfx/allegro_bitmap.h"
 #include "ags/shared/script/cc_options.h"
+#include "ags/lib/allegro/color.h"
+#include "ags/lib/allegro/gfx.h"
+#include "ags/lib/allegro/surface.h"
+#include "common/system.h"
 #include "image/png.h"
 
 namespace AGS {
@@ -35,6 +39,8 @@ AGSConsole::AGSConsole(AGSEngine *vm) : GUI::Debugger(), _vm(vm), _logOutputTarg
 	registerCmd("ags_set_script_dump", WRAP_METHOD(AGSConsole, Cmd_SetScriptDump));
 	registerCmd("ags_sprite_info",   WRAP_METHOD(AGSConsole, Cmd_getSpriteInfo));
 	registerCmd("ags_sprite_dump",  WRAP_METHOD(AGSConsole, Cmd_dumpSprite));
+	registerCmd("ags_sprite_cache_stats",  WRAP_METHOD(AGSConsole, Cmd_spriteCacheStats));
+	registerCmd("ags_draw_benchmark",  WRAP_METHOD(AGSConsole, Cmd_drawBenchmark));
 
 	_logOutputTarget = new LogOutputTarget();
 	_agsDebuggerOutput = _GP(DbgMgr).RegisterOutput("ScummVMLog", _logOutputTarget, AGS3::AGS::Shared::kDbgMsg_None);
@@ -244,6 +250,124 @@ bool AGSConsole::Cmd_dumpSprite(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_spriteCacheStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	AGS3::SpriteCache &spriteset = _GP(spriteset);
+	if (argc == 2) {
+		spriteset.ResetStats();
+		debugPrintf("Sprite cache counters reset\n");
+		return true;
+	}
+
+	const AGS3::SpriteCacheStats &stats = spriteset.GetStats();
+	debugPrintf("Cache size: %u KB of %u KB (%u KB locked)\n", (uint)(spriteset.GetCacheSize() / 1024),
+	            (uint)(spriteset.GetMaxCacheSize() / 1024), (uint)(spriteset.GetLockedSize() / 1024));
+	debugPrintf("Compressed: %u KB of %u KB\n", (uint)(spriteset.GetCompressedSize() / 1024),
+	            (uint)(spriteset.GetMaxCompressedSize() / 1024));
+	debugPrintf("Hits: %u, misses: %u, compressed hits: %u\n", stats.Hits, stats.Misses, stats.CompressedHits);
+	debugPrintf("Evictions: %u, compressed evictions: %u\n", stats.Evictions, stats.CompressedEvictions);
+	debugPrintf("Prefetched: %u\n", stats.Prefetched);
+	return true;
+}
+
+bool AGSConsole::Cmd_drawBenchmark(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: %s [frames]\n", argv[0]);
+		return true;
+	}
+
+	int frames = (argc == 2) ? atoi(argv[1]) : 100;
+	if (frames <= 0)
+		frames = 100;
+
+	// A typical high color room: a full screen background and a number
+	// of 32-bit characters drawn with the common blender modes
+	const int roomWidth = 640, roomHeight = 360;
+	const int charWidth = 64, charHeight = 128;
+	AGS3::BITMAP *room = AGS3::create_bitmap_ex(32, roomWidth, roomHeight);
+	AGS3::BITMAP *background = AGS3::create_bitmap_ex(32, roomWidth, roomHeight);
+	AGS3::BITMAP *sprite = AGS3::create_bitmap_ex(32, charWidth, charHeight);
+
+	for (int y = 0; y < roomHeight; ++y) {
+		uint32 *p = (uint32 *)background->getBasePtr(0, y);
+		for (int x = 0; x < roomWidth; ++x)
+			p[x] = 0xff000000 | ((x & 0xff) << 16) | ((y & 0xff) << 8) | ((x + y) & 0xff);
+	}
+	for (int y = 0; y < charHeight; ++y) {
+		uint32 *p = (uint32 *)sprite->getBasePtr(0, y);
+		for (int x = 0; x < charWidth; ++x) {
+			// Transparent border around an opaque body with soft edges
+			int edge = MIN(MIN(x, charWidth - 1 - x), MIN(y, charHeight - 1 - y));
+			if (edge < 4)
+				p[x] = 0x00ff00ff;
+			else
+				p[x] = (MIN(edge * 32, 255) << 24) | ((y * 2) << 16) | ((x * 4) << 8) | 0x40;
+		}
+	}
+
+	// Keep the game's blender settings intact
+	AGS3::BlenderMode oldMode = _G(_blender_mode);
+	int oldRed = _G(trans_blend_red), oldGreen = _G(trans_blend_green);
+	int oldBlue = _G(trans_blend_blue), oldAlpha = _G(trans_blend_alpha);
+
+	const char *const passNames[] = { "background", "alpha", "alpha flipped", "transparent", "tinted", "additive" };
+	uint32 passTimes[ARRAYSIZE(passNames)] = { 0 };
+
+	for (int frame = 0; frame < frames; ++frame) {
+		int pass = 0;
+		uint32 start = g_system->getMillis();
+		AGS3::blit(background, room, 0, 0, 0, 0, roomWidth, roomHeight);
+		passTimes[pass++] += g_system->getMillis() - start;
+
+		start = g_system->getMillis();
+		AGS3::set_alpha_blender();
+		for (int i = 0; i < 8; ++i)
+			AGS3::draw_trans_sprite(room, sprite, i * 80 - 8, 200 - (i & 1) * 40);
+		passTimes[pass++] += g_system->getMillis() - start;
+
+		start = g_system->getMillis();
+		for (int i = 0; i < 8; ++i)
+			room->draw(sprite, Common::Rect(0, 0, charWidth, charHeight), i * 80 + 20, 180 - (i & 1) * 40,
+			           true, false, true, 0);
+		passTimes[pass++] += g_system->getMillis() - start;
+
+		start = g_system->getMillis();
+		AGS3::set_trans_blender(0, 0, 0, 128);
+		for (int i = 0; i < 4; ++i)
+			AGS3::draw_trans_sprite(room, sprite, i * 150, 40);
+		passTimes[pass++] += g_system->getMillis() - start;
+
+		start = g_system->getMillis();
+		AGS3::set_blender_mode(AGS3::kTintLightBlenderMode, 64, 96, 200, 0);
+		for (int i = 0; i < 4; ++i)
+			AGS3::draw_lit_sprite(room, sprite, i * 150 + 40, 100, 180);
+		passTimes[pass++] += g_system->getMillis() - start;
+
+		start = g_system->getMillis();
+		AGS3::set_blender_mode(AGS3::kAdditiveBlenderMode, 0, 0, 0, 0);
+		for (int i = 0; i < 4; ++i)
+			AGS3::draw_trans_sprite(room, sprite, i * 150 + 80, 10);
+		passTimes[pass++] += g_system->getMillis() - start;
+	}
+	AGS3::set_blender_mode(oldMode, oldRed, oldGreen, oldBlue, oldAlpha);
+
+	uint32 total = 0;
+	for (uint i = 0; i < ARRAYSIZE(passNames); ++i) {
+		debugPrintf("%-14s %6u ms\n", passNames[i], passTimes[i]);
+		total += passTimes[i];
+	}
+	debugPrintf("%d frames in %u ms (%.2f ms/frame)\n", frames, total, (double)total / frames);
+
+	AGS3::destroy_bitmap(sprite);
+	AGS3::destroy_bitmap(background);
+	AGS3::destroy_bitmap(room);
+	return true;
+}
+
 LogOutputTarget::LogOutputTarget() {
 }
 
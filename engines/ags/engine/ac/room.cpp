@@ -66,6 +66,7 @@
 #include "ags/engine/script/script.h"
 #include "ags/engine/script/script_runtime.h"
 #include "ags/shared/ac/sprite_cache.h"
+#include "ags/shared/ac/view.h"
 #include "ags/shared/util/stream.h"
 #include "ags/engine/gfx/graphics_driver.h"
 #include "ags/shared/core/asset_manager.h"
@@ -415,6 +416,39 @@ static void update_all_viewcams_with_newroom() {
 	}
 }
 
+static void prefetch_view_loop(int view, int loop) {
+	if (view < 0 || view >= _GP(game).numviews || loop < 0 || loop >= _G(views)[view].numLoops)
+		return;
+	const ViewLoopNew &vloop = _G(views)[view].loops[loop];
+	for (int i = 0; i < vloop.numFrames; ++i)
+		_GP(spriteset).PrefetchSprite(vloop.frames[i].pic);
+}
+
+// Queues the sprites which room objects and characters are likely to use
+// soon, so that they are loaded over the next frames instead of on demand
+static void prefetch_room_sprites() {
+	_GP(spriteset).ClearPrefetch();
+	for (int i = 0; i < _G(croom)->numobj; ++i) {
+		const RoomObject &obj = _G(objs)[i];
+		if (!obj.on)
+			continue;
+		_GP(spriteset).PrefetchSprite(obj.num);
+		if (obj.cycling)
+			prefetch_view_loop(obj.view, obj.loop);
+	}
+	for (int i = 0; i < _GP(game).numcharacters; ++i) {
+		const CharacterInfo &chi = _GP(game).chars[i];
+		if (chi.room != _G(displayed_room) || !chi.on || chi.view < 0 || chi.view >= _GP(game).numviews)
+			continue;
+		// the current loop first, then the other directions
+		prefetch_view_loop(chi.view, chi.loop);
+		for (int loop = 0; loop < _G(views)[chi.view].numLoops; ++loop) {
+			if (loop != chi.loop)
+				prefetch_view_loop(chi.view, loop);
+		}
+	}
+}
+
 // Looks up for the room script available as a separate asset.
 // This is optional, so no error is raised if one is not found.
 // If found however, it will replace room script if one had been loaded
@@ -888,6 +922,7 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 		_GP(play).UpdateRoomCameras(); // update auto tracking
 	}
 	init_room_drawdata();
+	prefetch_room_sprites();
 
 	_G(our_eip) = 212;
 	invalidate_screen();
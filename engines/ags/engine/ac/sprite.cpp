@@ -172,4 +172,10 @@ void initialize_sprite(int ee) {
 	}
 }
 
+bool can_reuse_initialized_sprite() {
+	// plugins which listen for the sprite loads expect to receive
+	// every freshly loaded image
+	return !pl_any_want_hook(AGSE_SPRITELOAD);
+}
+
 } // namespace AGS3
@@ -32,6 +32,9 @@ void set_rgb_mask_using_alpha_channel(Shared::Bitmap *image);
 Shared::Bitmap *remove_alpha_channel(Shared::Bitmap *from);
 void pre_save_sprite(Shared::Bitmap *bitmap);
 void initialize_sprite(int ee);
+// Tells if a sprite image prepared by initialize_sprite may be kept and
+// reused later instead of loading and initializing the sprite again
+bool can_reuse_initialized_sprite();
 
 } // namespace AGS3
 
@@ -23,6 +23,8 @@
 // Game loop
 //
 
+#include "common/config-manager.h"
+#include "common/system.h"
 #include "ags/lib/std/limits.h"
 #include "ags/engine/ac/button.h"
 #include "ags/shared/ac/common.h"
@@ -46,6 +48,7 @@
 #include "ags/engine/ac/overlay.h"
 #include "ags/shared/ac/sprite_cache.h"
 #include "ags/engine/ac/sys_events.h"
+#include "ags/engine/ac/timer.h"
 #include "ags/engine/ac/room.h"
 #include "ags/engine/ac/room_object.h"
 #include "ags/engine/ac/room_status.h"
@@ -787,6 +790,9 @@ void UpdateGameOnce(bool checkControls, IDriverDependantBitmap *extraBitmap, int
 	if (_G(abort_engine))
 		return;
 
+	// use a bit of the frame time to load the sprites the room will need
+	_GP(spriteset).ProcessPrefetch(2);
+
 	WaitForNextFrame();
 }
 
@@ -980,6 +986,17 @@ void RunGameUntilAborted() {
 	// skip ticks to account for time spent starting _GP(game).
 	skipMissedTicks();
 
+	// Benchmark mode: run the given number of game ticks without waiting
+	// for the frame timer, report the script throughput and quit
+	int benchmark_ticks = ConfMan.hasKey("script_benchmark_ticks") ? ConfMan.getInt("script_benchmark_ticks") : 0;
+	int ticks_run = 0;
+	uint32 benchmark_start = 0;
+	if (benchmark_ticks > 0) {
+		setTimerFps(1000);
+		_G(scriptInstructionCount) = 0;
+		benchmark_start = g_system->getMillis();
+	}
+
 	while (!_G(abort_engine)) {
 		GameTick();
 
@@ -987,6 +1004,14 @@ void RunGameUntilAborted() {
 			RunAGSGame(nullptr, _G(load_new_game), 0);
 			_G(load_new_game) = 0;
 		}
+
+		if (benchmark_ticks > 0 && ++ticks_run == benchmark_ticks) {
+			uint32 elapsed = MAX<uint32>(g_system->getMillis() - benchmark_start, 1);
+			Debug::Printf(kDbgMsg_Info, "Script benchmark: %d ticks, %u instructions in %u ms (%u instructions/s)",
+				ticks_run, _G(scriptInstructionCount), elapsed,
+				(uint32)((uint64)_G(scriptInstructionCount) * 1000 / elapsed));
+			quit("||exit!");
+		}
 	}
 }
 
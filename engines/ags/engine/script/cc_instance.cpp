@@ -223,6 +223,8 @@ ccInstance::ccInstance() {
 	numimports = 0;
 	resolved_imports = nullptr;
 	code_fixups         = nullptr;
+	decoded_ops         = nullptr;
+	decoded_op_index    = nullptr;
 
 	memset(callStackLineNumber, 0, sizeof(callStackLineNumber));
 	memset(callStackAddr, 0, sizeof(callStackAddr));
@@ -417,7 +419,9 @@ int ccInstance::Run(int32_t curpc) {
 	ccInstance *codeInst = runningInst;
 	bool write_debug_dump = ccGetOption(SCOPT_DEBUGRUN) ||
 		(gDebugLevel > 0 && DebugMan.isDebugChannelEnabled(::AGS::kDebugScript));
+	const bool use_decode_cache = ccGetOption(SCOPT_NODECODECACHE) == 0;
 	ScriptOperation codeOp;
+	DecodedOperation uncachedOp;
 
 	FunctionCallStack func_callstack;
 
@@ -425,58 +429,31 @@ int ccInstance::Run(int32_t curpc) {
 		if (_G(abort_engine))
 			return -1;
 
-		/*
-		if (!codeInst->ReadOperation(codeOp, pc))
-		{
-		    return -1;
-		}
-		*/
-		/* ReadOperation */
-		//=====================================================================
-		codeOp.Instruction.Code         = codeInst->code[pc];
-		codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
-		codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
-
-		if (codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS) {
-			cc_error("invalid instruction %d found in code stream", codeOp.Instruction.Code);
-			return -1;
-		}
-
-		codeOp.ArgCount = sccmd_info[codeOp.Instruction.Code].ArgCount;
-		if (pc + codeOp.ArgCount >= codeInst->codesize) {
-			cc_error("unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
-			return -1;
+		DecodedOperation *decodedOp;
+		const int32_t op_index = use_decode_cache ? codeInst->decoded_op_index[pc] : -1;
+		if (op_index >= 0) {
+			decodedOp = &codeInst->decoded_ops[op_index];
+			if (!decodedOp->Decoded && !codeInst->DecodeOperation(*decodedOp, pc))
+				return -1;
+		} else {
+			// the cache is disabled, or this is not one of the instruction
+			// boundaries found when the instance was created
+			decodedOp = &uncachedOp;
+			if (!codeInst->DecodeOperation(uncachedOp, pc))
+				return -1;
 		}
 
-		int pc_at = pc + 1;
-		for (int i = 0; i < codeOp.ArgCount; ++i, ++pc_at) {
-			char fixup = codeInst->code_fixups[pc_at];
-			if (fixup > 0) {
-				// could be relative pointer or import address
-				/*
-				if (!FixupArgument(code[pc], fixup, codeOp.Args[i]))
-				{
-				    return -1;
-				}
-				*/
-				/* FixupArgument */
-				//=====================================================================
-				switch (fixup) {
-				case FIXUP_GLOBALDATA: {
-					ScriptVariable *gl_var = (ScriptVariable *)codeInst->code[pc_at];
-					codeOp.Args[i].SetGlobalVar(&gl_var->RValue);
-				}
-				break;
-				case FIXUP_FUNCTION:
-					// originally commented -- CHECKME: could this be used in very old versions of AGS?
-					//      code[fixup] += (long)&code[0];
-					// This is a program counter value, presumably will be used as SCMD_CALL argument
-					codeOp.Args[i].SetInt32((int32_t)codeInst->code[pc_at]);
-					break;
-				case FIXUP_STRING:
-					codeOp.Args[i].SetStringLiteral(&codeInst->strings[0] + codeInst->code[pc_at]);
-					break;
-				case FIXUP_IMPORT: {
+		const ScriptOperation *op = &decodedOp->Op;
+		if (decodedOp->RuntimeArgs != 0) {
+			// only stack and import arguments may change between runs
+			codeOp = decodedOp->Op;
+			int pc_at = pc + 1;
+			for (int i = 0; i < codeOp.ArgCount; ++i, ++pc_at) {
+				if ((decodedOp->RuntimeArgs & (1 << i)) == 0)
+					continue;
+				if (codeInst->code_fixups[pc_at] == FIXUP_STACK) {
+					codeOp.Args[i] = GetStackPtrOffsetFw((int32_t)codeInst->code[pc_at]);
+				} else {
 					const ScriptImport *import = _GP(simp).getByIndex((int32_t)codeInst->code[pc_at]);
 					if (import) {
 						codeOp.Args[i] = import->Value;
@@ -485,28 +462,15 @@ int ccInstance::Run(int32_t curpc) {
 						return -1;
 					}
 				}
-				break;
-				case FIXUP_STACK:
-					codeOp.Args[i] = GetStackPtrOffsetFw((int32_t)codeInst->code[pc_at]);
-					break;
-				default:
-					cc_error("internal fixup type error: %d", fixup);
-					return -1;
-				}
-				/* End FixupArgument */
-				//=====================================================================
-			} else {
-				// should be a numeric literal (int32 or float)
-				codeOp.Args[i].SetInt32((int32_t)codeInst->code[pc_at]);
 			}
+			op = &codeOp;
 		}
-		/* End ReadOperation */
-		//=====================================================================
+		_G(scriptInstructionCount)++;
 
 		// save the arguments for quick access
-		RuntimeScriptValue &arg1 = codeOp.Args[0];
-		RuntimeScriptValue &arg2 = codeOp.Args[1];
-		RuntimeScriptValue &arg3 = codeOp.Args[2];
+		const RuntimeScriptValue &arg1 = op->Args[0];
+		const RuntimeScriptValue &arg2 = op->Args[1];
+		const RuntimeScriptValue &arg3 = op->Args[2];
 		RuntimeScriptValue &reg1 =
 		    registers[arg1.IValue >= 0 && arg1.IValue < CC_NUM_REGISTERS ? arg1.IValue : 0];
 		RuntimeScriptValue &reg2 =
@@ -516,10 +480,10 @@ int ccInstance::Run(int32_t curpc) {
 		const char *direct_ptr2;
 
 		if (write_debug_dump) {
-			DumpInstruction(codeOp);
+			DumpInstruction(*op);
 		}
 
-		switch (codeOp.Instruction.Code) {
+		switch (op->Instruction.Code) {
 		case SCMD_LINENUM:
 			line_number = arg1.IValue;
 			_G(currentline) = arg1.IValue;
@@ -698,7 +662,7 @@ int ccInstance::Run(int32_t curpc) {
 			PUSH_CALL_STACK;
 
 			ASSERT_STACK_SPACE_AVAILABLE(1);
-			PushValueToStack(RuntimeScriptValue().SetInt32(pc + codeOp.ArgCount + 1));
+			PushValueToStack(RuntimeScriptValue().SetInt32(pc + op->ArgCount + 1));
 			if (_G(ccError)) {
 				return -1;
 			}
@@ -939,7 +903,7 @@ int ccInstance::Run(int32_t curpc) {
 			ccInstance *wasRunning = runningInst;
 
 			// extract the instance ID
-			int32_t instId = codeOp.Instruction.InstanceId;
+			int32_t instId = op->Instruction.InstanceId;
 			// determine the offset into the code of the instance we want
 			runningInst = _G(loadedInstances)[instId];
 			intptr_t callAddr = reg1.Ptr - (char *)&runningInst->code[0];
@@ -1200,14 +1164,14 @@ int ccInstance::Run(int32_t curpc) {
 				loopIterationCheckDisabled++;
 			break;
 		default:
-			cc_error("instruction %d is not implemented", codeOp.Instruction.Code);
+			cc_error("instruction %d is not implemented", op->Instruction.Code);
 			return -1;
 		}
 
 		if (flags & INSTF_ABORTED)
 			return 0;
 
-		pc += codeOp.ArgCount + 1;
+		pc += op->ArgCount + 1;
 	}
 }
 
@@ -1391,6 +1355,8 @@ bool ccInstance::_Create(PScript scri, ccInstance *joined) {
 	if (joined) {
 		resolved_imports = joined->resolved_imports;
 		code_fixups = joined->code_fixups;
+		decoded_ops = joined->decoded_ops;
+		decoded_op_index = joined->decoded_op_index;
 	} else {
 		if (!ResolveScriptImports(scri)) {
 			return false;
@@ -1401,6 +1367,7 @@ bool ccInstance::_Create(PScript scri, ccInstance *joined) {
 		if (!CreateRuntimeCodeFixups(scri)) {
 			return false;
 		}
+		CreateDecodedOperations();
 	}
 
 	exports = new RuntimeScriptValue[scri->numexports];
@@ -1476,9 +1443,12 @@ void ccInstance::Free() {
 	if ((flags & INSTF_SHAREDATA) == 0) {
 		delete[] resolved_imports;
 		delete[] code_fixups;
+		FreeDecodedOperations();
 	}
 	resolved_imports = nullptr;
 	code_fixups = nullptr;
+	decoded_ops = nullptr;
+	decoded_op_index = nullptr;
 }
 
 bool ccInstance::ResolveScriptImports(PScript scri) {
@@ -1656,6 +1626,97 @@ bool ccInstance::CreateRuntimeCodeFixups(PScript scri) {
 	return true;
 }
 
+void ccInstance::CreateDecodedOperations() {
+	decoded_op_index = new int32_t[codesize > 0 ? codesize : 1];
+	for (int32_t i = 0; i < codesize; ++i)
+		decoded_op_index[i] = -1;
+
+	// Operations are followed by their arguments, so the instruction
+	// boundaries are found by skipping over those. Anything past invalid
+	// data is left without an entry and decoded on each execution, which
+	// reports the same errors as before.
+	int32_t num_ops = 0;
+	for (int32_t at_pc = 0; at_pc < codesize;) {
+		int32_t instruction = code[at_pc] & INSTANCE_ID_REMOVEMASK;
+		if (instruction < 0 || instruction >= CC_NUM_SCCMDS)
+			break;
+		int32_t arg_count = sccmd_info[instruction].ArgCount;
+		if (at_pc + arg_count >= codesize)
+			break;
+		decoded_op_index[at_pc] = num_ops++;
+		at_pc += arg_count + 1;
+	}
+
+	decoded_ops = new DecodedOperation[num_ops > 0 ? num_ops : 1];
+}
+
+bool ccInstance::DecodeOperation(DecodedOperation &decoded, int32_t at_pc) {
+	ScriptOperation op;
+	op.Instruction.Code         = code[at_pc];
+	op.Instruction.InstanceId   = (op.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
+	op.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
+
+	if (op.Instruction.Code < 0 || op.Instruction.Code >= CC_NUM_SCCMDS) {
+		cc_error("invalid instruction %d found in code stream", op.Instruction.Code);
+		return false;
+	}
+
+	op.ArgCount = sccmd_info[op.Instruction.Code].ArgCount;
+	if (at_pc + op.ArgCount >= codesize) {
+		cc_error("unexpected end of code data (%d; %d)", at_pc + op.ArgCount, codesize);
+		return false;
+	}
+
+	uint8_t runtime_args = 0;
+	int pc_at = at_pc + 1;
+	for (int i = 0; i < op.ArgCount; ++i, ++pc_at) {
+		char fixup = code_fixups[pc_at];
+		if (fixup > 0) {
+			// could be relative pointer or import address
+			switch (fixup) {
+			case FIXUP_GLOBALDATA: {
+				ScriptVariable *gl_var = (ScriptVariable *)code[pc_at];
+				op.Args[i].SetGlobalVar(&gl_var->RValue);
+			}
+			break;
+			case FIXUP_FUNCTION:
+				// originally commented -- CHECKME: could this be used in very old versions of AGS?
+				//      code[fixup] += (long)&code[0];
+				// This is a program counter value, presumably will be used as SCMD_CALL argument
+				op.Args[i].SetInt32((int32_t)code[pc_at]);
+				break;
+			case FIXUP_STRING:
+				op.Args[i].SetStringLiteral(&strings[0] + code[pc_at]);
+				break;
+			case FIXUP_IMPORT:
+			case FIXUP_STACK:
+				// imports may be replaced when scripts are loaded and unloaded,
+				// and stack offsets depend on the current stack contents
+				runtime_args |= (1 << i);
+				break;
+			default:
+				cc_error("internal fixup type error: %d", fixup);
+				return false;
+			}
+		} else {
+			// should be a numeric literal (int32 or float)
+			op.Args[i].SetInt32((int32_t)code[pc_at]);
+		}
+	}
+
+	decoded.Op = op;
+	decoded.RuntimeArgs = runtime_args;
+	decoded.Decoded = true;
+	return true;
+}
+
+void ccInstance::FreeDecodedOperations() {
+	delete[] decoded_ops;
+	delete[] decoded_op_index;
+	decoded_ops = nullptr;
+	decoded_op_index = nullptr;
+}
+
 /*
 bool ccInstance::ReadOperation(ScriptOperation &op, int32_t at_pc)
 {
@@ -71,6 +71,21 @@ struct ScriptOperation {
 	int                 ArgCount;
 };
 
+// Operation decoded once from the code stream and reused on every later
+// execution of the same program counter. Arguments which depend on the
+// current state (stack offsets and imports) are flagged in RuntimeArgs and
+// resolved again each time the operation is run.
+struct DecodedOperation {
+	DecodedOperation() {
+		RuntimeArgs = 0;
+		Decoded = false;
+	}
+
+	ScriptOperation     Op;
+	uint8_t             RuntimeArgs;    // bitmask of arguments to resolve at runtime
+	bool                Decoded;        // Op is valid, set on first execution
+};
+
 struct ScriptVariable {
 	ScriptVariable() {
 		ScAddress = -1; // address = 0 is valid one, -1 means undefined
@@ -142,6 +157,11 @@ public:
 	int  numimports;
 
 	char *code_fixups;
+	// decoded operations in code order, filled on first use, and the index
+	// of each program counter's entry in them (-1 if there is none);
+	// shared between forks just like the code itself
+	DecodedOperation *decoded_ops;
+	int32_t *decoded_op_index;
 
 	// returns the currently executing instance, or NULL if none
 	static ccInstance *GetCurrentInstance(void);
@@ -185,6 +205,12 @@ protected:
 	ScriptVariable *FindGlobalVar(int32_t var_addr);
 	bool    CreateRuntimeCodeFixups(PScript scri);
 	//bool    ReadOperation(ScriptOperation &op, int32_t at_pc);
+	// Allocates the decoded operation cache, with one entry for each
+	// instruction found by walking the code from the start
+	void    CreateDecodedOperations();
+	// Decodes the operation at the given program counter; returns false on error
+	bool    DecodeOperation(DecodedOperation &decoded, int32_t at_pc);
+	void    FreeDecodedOperations();
 
 	// Runtime fixups
 	//bool    FixupArgument(intptr_t code_value, char fixup_type, RuntimeScriptValue &argument);
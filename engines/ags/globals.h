@@ -373,6 +373,8 @@ public:
 	// Of 2012-12-20: now used only for plugin exports
 	RuntimeScriptValue *_GlobalReturnValue;
 	Common::DumpFile *_scriptDumpFile = nullptr;
+	// total number of script instructions executed, for benchmarking
+	uint32 _scriptInstructionCount = 0;
 
 	/**@}*/
 
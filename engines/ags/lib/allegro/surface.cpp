@@ -107,6 +107,213 @@ void BITMAP::floodfill(int x, int y, int color) {
 const int SCALE_THRESHOLD = 0x100;
 #define VGA_COLOR_TRANS(x) ((x) * 255 / 63)
 
+/*-------------------------------------------------------------------*/
+
+// Specialized row loops for drawing between 32-bit ARGB bitmaps, which is
+// what high color games use for all their sprites. Each kernel works on
+// whole pixels and produces exactly the same result as the generic
+// per-component blendPixel path.
+
+static const uint32 TRANS_KEY_32 = 0x00ff00ff;
+static const uint32 RGB_MASK_32 = 0x00ffffff;
+
+// Same arithmetic as BITMAP::rgbBlend, on packed pixels
+static inline uint32 rgbBlend32(uint32 src, uint32 dst, uint32 alpha) {
+	if (alpha)
+		alpha++;
+	uint32 x = src & RGB_MASK_32;
+	uint32 y = dst & RGB_MASK_32;
+	uint32 res = ((x & 0xff00ff) - (y & 0xff00ff)) * alpha / 256 + y;
+	uint32 g = ((x & 0xff00) - (y & 0xff00)) * alpha / 256 + (y & 0xff00);
+	return (res & 0xff00ff) | (g & 0xff00);
+}
+
+struct CopyKernel32 {
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		return src;
+	}
+};
+
+// kSourceAlphaBlender
+struct SourceAlphaKernel32 {
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		return rgbBlend32(src, dst, src >> 24);
+	}
+};
+
+// kRgbToRgbBlender
+struct RgbToRgbKernel32 {
+	uint32 _alpha;
+	RgbToRgbKernel32(uint32 alpha) : _alpha(alpha) {}
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		return rgbBlend32(src, dst, _alpha);
+	}
+};
+
+// kAlphaPreservedBlenderMode
+struct PreserveAlphaKernel32 {
+	uint32 _alpha;
+	PreserveAlphaKernel32(uint32 alpha) : _alpha(alpha) {}
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		return rgbBlend32(src, dst, _alpha) | (dst & ~RGB_MASK_32);
+	}
+};
+
+// kOpaqueBlenderMode
+struct OpaqueKernel32 {
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		return src | ~RGB_MASK_32;
+	}
+};
+
+// kAdditiveBlenderMode
+struct AdditiveKernel32 {
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		uint32 a = (src >> 24) + (dst >> 24);
+		if (a > 0xff)
+			a = 0xff;
+		return (src & RGB_MASK_32) | (a << 24);
+	}
+};
+
+// kTintBlenderMode and kTintLightBlenderMode. The result only depends on the
+// sprite pixel, so the tint color is converted once and the last result is
+// remembered for runs of the same color.
+struct TintKernel32 {
+	float _h, _s;
+	bool _light;
+	double _lightAdjust;
+	mutable uint32 _lastSrc, _lastResult;
+	mutable bool _hasLast;
+
+	TintKernel32(int tintRed, int tintGreen, int tintBlue, int alpha, bool light) :
+			_light(light), _lastSrc(0), _lastResult(0), _hasLast(false) {
+		float v;
+		rgb_to_hsv(tintRed, tintGreen, tintBlue, &_h, &_s, &v);
+		_lightAdjust = 1.0 - ((float)alpha / 250.0);
+	}
+	inline uint32 operator()(uint32 src, uint32 dst) const {
+		if (_hasLast && src == _lastSrc)
+			return _lastResult;
+		float h, s, v;
+		int r, g, b;
+		rgb_to_hsv((src >> 16) & 0xff, (src >> 8) & 0xff, src & 0xff, &h, &s, &v);
+		if (_light) {
+			// adjust luminance
+			v -= _lightAdjust;
+			if (v < 0.0)
+				v = 0.0;
+		}
+		hsv_to_rgb(_h, _s, v, &r, &g, &b);
+		_lastSrc = src;
+		_lastResult = (src & ~RGB_MASK_32) | ((r & 0xff) << 16) | ((g & 0xff) << 8) | (b & 0xff);
+		_hasLast = true;
+		return _lastResult;
+	}
+};
+
+template<bool HorizFlip, bool SkipTrans, class Kernel>
+static void drawRows32(Graphics::Surface &destArea, const Graphics::Surface &src,
+		const Common::Rect &srcArea, bool vertFlip, int xStart, int yStart,
+		int width, int height, const Kernel &kernel) {
+	// Only iterate over the part of the sprite inside the clipping area
+	const int xFirst = -xStart;
+	const int xCount = MIN<int>(width + xStart, destArea.w);
+	const int yFirst = -yStart;
+	const int yCount = MIN<int>(height + yStart, destArea.h);
+
+	for (int destY = 0, yCtr = yFirst; destY < yCount; ++destY, ++yCtr) {
+		uint32 *destP = (uint32 *)destArea.getBasePtr(0, destY);
+		const uint32 *srcP = (const uint32 *)src.getBasePtr(
+		                         HorizFlip ? srcArea.right - 1 - xFirst : srcArea.left + xFirst,
+		                         vertFlip ? srcArea.bottom - 1 - yCtr : srcArea.top + yCtr);
+
+		for (int destX = 0; destX < xCount; ++destX) {
+			uint32 srcCol = HorizFlip ? *(srcP - destX) : srcP[destX];
+			if (SkipTrans && (srcCol & RGB_MASK_32) == TRANS_KEY_32)
+				continue;
+			destP[destX] = kernel(srcCol, destP[destX]);
+		}
+	}
+}
+
+template<class Kernel>
+static void drawRows32(Graphics::Surface &destArea, const Graphics::Surface &src,
+		const Common::Rect &srcArea, bool horizFlip, bool vertFlip, bool skipTrans,
+		int xStart, int yStart, int width, int height, const Kernel &kernel) {
+	if (horizFlip) {
+		if (skipTrans)
+			drawRows32<true, true>(destArea, src, srcArea, vertFlip, xStart, yStart, width, height, kernel);
+		else
+			drawRows32<true, false>(destArea, src, srcArea, vertFlip, xStart, yStart, width, height, kernel);
+	} else {
+		if (skipTrans)
+			drawRows32<false, true>(destArea, src, srcArea, vertFlip, xStart, yStart, width, height, kernel);
+		else
+			drawRows32<false, false>(destArea, src, srcArea, vertFlip, xStart, yStart, width, height, kernel);
+	}
+}
+
+bool BITMAP::drawFast32(const Graphics::ManagedSurface &src, Graphics::Surface &destArea,
+		const Common::Rect &srcArea, int xStart, int yStart, int width, int height,
+		bool horizFlip, bool vertFlip, bool skipTrans, int srcAlpha,
+		int tintRed, int tintGreen, int tintBlue) const {
+	static const Graphics::PixelFormat argbFormat(4, 8, 8, 8, 8, 16, 8, 0, 24);
+	if (format != argbFormat || src.format != argbFormat)
+		return false;
+
+	const Graphics::Surface &srcSurf = src.rawSurface();
+	const bool useTint = (tintRed >= 0 && tintGreen >= 0 && tintBlue >= 0);
+
+	if (srcAlpha == -1) {
+		if (!horizFlip && !skipTrans) {
+			const int xCount = MIN<int>(width + xStart, destArea.w);
+			const int yCount = MIN<int>(height + yStart, destArea.h);
+			for (int destY = 0, yCtr = -yStart; destY < yCount; ++destY, ++yCtr) {
+				memmove(destArea.getBasePtr(0, destY),
+				        srcSurf.getBasePtr(srcArea.left - xStart,
+				                           vertFlip ? srcArea.bottom - 1 - yCtr : srcArea.top + yCtr),
+				        xCount * 4);
+			}
+		} else {
+			drawRows32(destArea, srcSurf, srcArea, horizFlip, vertFlip, skipTrans, xStart, yStart, width, height, CopyKernel32());
+		}
+		return true;
+	}
+
+	if (useTint) {
+		if (_G(_blender_mode) != kTintBlenderMode && _G(_blender_mode) != kTintLightBlenderMode)
+			return false;
+		TintKernel32 kernel(tintRed, tintGreen, tintBlue, srcAlpha, _G(_blender_mode) == kTintLightBlenderMode);
+		drawRows32(destArea, srcSurf, srcArea, horizFlip, vertFlip, skipTrans, xStart, yStart, width, height, kernel);
+		return true;
+	}
+
+	switch (_G(_blender_mode)) {
+	case kSourceAlphaBlender:
+		drawRows32(destArea, srcSurf, srcArea, horizFlip, vertFlip, skipTrans, xStart, yStart, width, height, SourceAlphaKernel32());
+		return true;
+	case kRgbToRgbBlender:
+		drawRows32(destArea, srcSurf, srcArea, horizFlip, vertFlip, skipTrans, xStart, yStart, width, height, RgbToRgbKernel32(srcAlpha));
+		return true;
+	case kAlphaPreservedBlenderMode:
+		drawRows32(destArea, srcSurf, srcArea, horizFlip, vertFlip, skipTrans, xStart, yStart, width, height, PreserveAlphaKernel32(srcAlpha));
+		return true;
+	case kOpaqueBlenderMode:
+		drawRows32(destArea, srcSurf, srcArea, horizFlip, vertFlip, skipTrans, xStart, yStart, width, height, OpaqueKernel32());
+		return true;
+	case kAdditiveBlenderMode:
+		drawRows32(destArea, srcSurf, srcArea, horizFlip, vertFlip, skipTrans, xStart, yStart, width, height, AdditiveKernel32());
+		return true;
+	default:
+		// The ARGB blenders use floating point math and tint modes need the
+		// tint color, so they go through the generic path
+		return false;
+	}
+}
+
+/*-------------------------------------------------------------------*/
+
 void BITMAP::draw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
                   int dstX, int dstY, bool horizFlip, bool vertFlip,
                   bool skipTrans, int srcAlpha, int tintRed, int tintGreen,
@@ -166,6 +373,11 @@ void BITMAP::draw(const BITMAP *srcBitmap, const Common::Rect &srcRect,
 	int xStart = (dstRect.left < destRect.left) ? dstRect.left - destRect.left : 0;
 	int yStart = (dstRect.top < destRect.top) ? dstRect.top - destRect.top : 0;
 
+	if (format.bytesPerPixel == 4 && sameFormat &&
+	        drawFast32(src, destArea, srcArea, xStart, yStart, dstRect.width(), dstRect.height(),
+	                   horizFlip, vertFlip, skipTrans, srcAlpha, tintRed, tintGreen, tintBlue))
+		return;
+
 	for (int destY = yStart, yCtr = 0; yCtr < dstRect.height(); ++destY, ++yCtr) {
 		if (destY < 0 || destY >= destArea.h)
 			continue;
@@ -131,6 +131,13 @@ public:
 
 	void blendPixel(uint8 aSrc, uint8 rSrc, uint8 gSrc, uint8 bSrc, uint8 &aDest, uint8 &rDest, uint8 &gDest, uint8 &bDest, uint32 alpha) const;
 
+	// Specialized draw loops for 32-bit ARGB to 32-bit ARGB blits.
+	// Returns false if the blender mode has to use the generic path.
+	bool drawFast32(const Graphics::ManagedSurface &src, Graphics::Surface &destArea,
+	                const Common::Rect &srcArea, int xStart, int yStart, int width, int height,
+	                bool horizFlip, bool vertFlip, bool skipTrans, int srcAlpha,
+	                int tintRed, int tintGreen, int tintBlue) const;
+
 
 	inline void rgbBlend(uint8 rSrc, uint8 gSrc, uint8 bSrc, uint8 &rDest, uint8 &gDest, uint8 &bDest, uint32 alpha) const {
 		// Note: the original's handling varies slightly for R & B vs G.
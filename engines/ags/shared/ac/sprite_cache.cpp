@@ -41,6 +41,7 @@
 #include "ags/shared/gfx/bitmap.h"
 #include "ags/shared/util/compress.h"
 #include "ags/shared/util/file.h"
+#include "ags/shared/util/memory_stream.h"
 #include "ags/shared/util/stream.h"
 #include "ags/globals.h"
 
@@ -50,6 +51,7 @@ using namespace AGS::Shared;
 
 // [IKM] We have to forward-declare these because their implementations are in the Engine
 extern void initialize_sprite(int);
+extern bool can_reuse_initialized_sprite();
 extern void pre_save_sprite(Bitmap *image);
 extern void get_new_size_for_sprite(int, int, int, int &, int &);
 
@@ -110,6 +112,22 @@ size_t SpriteCache::GetSpriteSlotCount() const {
 	return _spriteData.size();
 }
 
+size_t SpriteCache::GetCompressedSize() const {
+	return _compressedSize;
+}
+
+size_t SpriteCache::GetMaxCompressedSize() const {
+	return _maxCompressedSize;
+}
+
+const SpriteCacheStats &SpriteCache::GetStats() const {
+	return _stats;
+}
+
+void SpriteCache::ResetStats() {
+	_stats = SpriteCacheStats();
+}
+
 sprkey_t SpriteFile::FindTopmostSprite(const std::vector<Bitmap *> &sprites) {
 	sprkey_t topmost = -1;
 	for (sprkey_t i = 0; i < static_cast<sprkey_t>(sprites.size()); ++i)
@@ -120,6 +138,14 @@ sprkey_t SpriteFile::FindTopmostSprite(const std::vector<Bitmap *> &sprites) {
 
 void SpriteCache::SetMaxCacheSize(size_t size) {
 	_maxCacheSize = size;
+	// compressed copies take an extra quarter of the cache budget
+	SetMaxCompressedSize(size / 4);
+}
+
+void SpriteCache::SetMaxCompressedSize(size_t size) {
+	_maxCompressedSize = size;
+	while (_compressedSize > _maxCompressedSize && !_compressedList.empty())
+		DisposeOldestCompressed();
 }
 
 void SpriteCache::Init() {
@@ -128,6 +154,10 @@ void SpriteCache::Init() {
 	_maxCacheSize = (size_t)DEFAULTCACHESIZE_KB * 1024;
 	_liststart = -1;
 	_listend = -1;
+	_compressedSeq = 0;
+	_compressedSize = 0;
+	_prefetching = false;
+	_maxCompressedSize = _maxCacheSize / 4;
 }
 
 void SpriteCache::Reset() {
@@ -143,6 +173,8 @@ void SpriteCache::Reset() {
 
 	_mrulist.clear();
 	_mrubacklink.clear();
+	_compressedList.clear();
+	_prefetchList.clear();
 
 	Init();
 }
@@ -156,6 +188,7 @@ void SpriteCache::SetSprite(sprkey_t index, Bitmap *sprite) {
 		Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Error, "SetSprite: attempt to assign nullptr to index %d", index);
 		return;
 	}
+	DisposeCompressed(index);
 	_spriteData[index].Image = sprite;
 	_spriteData[index].Flags = SPRCACHEFLAG_LOCKED; // NOT from asset file
 	_spriteData[index].Size = 0;
@@ -179,6 +212,7 @@ void SpriteCache::SubstituteBitmap(sprkey_t index, Bitmap *sprite) {
 		Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Error, "SubstituteBitmap: attempt to set for non-existing sprite %d", index);
 		return;
 	}
+	DisposeCompressed(index);
 	_spriteData[index].Image = sprite;
 #ifdef DEBUG_SPRITECACHE
 	Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Debug, "SubstituteBitmap: %d", index);
@@ -188,6 +222,7 @@ void SpriteCache::SubstituteBitmap(sprkey_t index, Bitmap *sprite) {
 void SpriteCache::RemoveSprite(sprkey_t index, bool freeMemory) {
 	if (freeMemory)
 		delete _spriteData[index].Image;
+	DisposeCompressed(index);
 	InitNullSpriteParams(index);
 #ifdef DEBUG_SPRITECACHE
 	Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Debug, "RemoveSprite: %d", index);
@@ -254,13 +289,17 @@ Bitmap *SpriteCache::operator [] (sprkey_t index) {
 		return _spriteData[index].Image;
 
 	// Sprite exists in file but is not in mem, load it
-	if ((_spriteData[index].Image == nullptr) && _spriteData[index].IsAssetSprite())
+	const bool was_loaded = _spriteData[index].Image != nullptr;
+	if (!was_loaded && _spriteData[index].IsAssetSprite())
 		LoadSprite(index);
 
 	// Locked sprite that shouldn't be put into MRU list
 	if (_spriteData[index].IsLocked())
 		return _spriteData[index].Image;
 
+	if (was_loaded)
+		_stats.Hits++;
+
 	if (_liststart < 0) {
 		_liststart = index;
 		_listend = index;
@@ -303,8 +342,13 @@ void SpriteCache::DisposeOldest() {
 		}
 		_cacheSize -= _spriteData[sprnum].Size;
 
+		// keep a compressed copy, unless there's a valid one already
+		if (_spriteData[sprnum].Compressed.Data.empty() &&
+		        (_spriteData[sprnum].Flags & SPRCACHEFLAG_REMAPPED) == 0 && can_reuse_initialized_sprite())
+			CompressSprite(sprnum, _spriteData[sprnum].Image);
 		delete _spriteData[sprnum].Image;
 		_spriteData[sprnum].Image = nullptr;
+		_stats.Evictions++;
 	}
 
 	if (_liststart == _listend) {
@@ -402,34 +446,48 @@ size_t SpriteCache::LoadSprite(sprkey_t index) {
 	if (index < 0 || (size_t)index >= _spriteData.size())
 		quit("sprite cache array index out of bounds");
 
-	sprkey_t load_index = GetDataIndex(index);
-	Bitmap *image;
-	HError err = _file.LoadSprite(load_index, image);
-	if (!image) {
-		Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Warn,
-			"LoadSprite: failed to load sprite %d:\n%s\n - remapping to sprite 0.", index,
-			err ? err->FullMessage().GetCStr() : "Sprite does not exist.");
-		RemapSpriteToSprite0(index);
-		return 0;
-	}
+	// a compressed copy holds the image as it was after initialization,
+	// so it is put back as is
+	Bitmap *image = nullptr;
+	if (!_spriteData[index].Compressed.Data.empty())
+		image = RestoreCompressedSprite(index);
 
-	// update the stored width/height
-	_sprInfos[index].Width = image->GetWidth();
-	_sprInfos[index].Height = image->GetHeight();
-	_spriteData[index].Image = image;
+	if (image) {
+		if (!_prefetching)
+			_stats.CompressedHits++;
+		_spriteData[index].Image = image;
+	} else {
+		if (!_prefetching)
+			_stats.Misses++;
+
+		sprkey_t load_index = GetDataIndex(index);
+		HError err = _file.LoadSprite(load_index, image);
+		if (!image) {
+			Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Warn,
+				"LoadSprite: failed to load sprite %d:\n%s\n - remapping to sprite 0.", index,
+				err ? err->FullMessage().GetCStr() : "Sprite does not exist.");
+			RemapSpriteToSprite0(index);
+			return 0;
+		}
 
-	// Stop it adding the sprite to the used list just because it's loaded
-	// TODO: this messy hack is required, because initialize_sprite calls operator[]
-	// which puts the sprite to the MRU list.
-	_spriteData[index].Flags |= SPRCACHEFLAG_LOCKED;
+		// update the stored width/height
+		_sprInfos[index].Width = image->GetWidth();
+		_sprInfos[index].Height = image->GetHeight();
+		_spriteData[index].Image = image;
+
+		// Stop it adding the sprite to the used list just because it's loaded
+		// TODO: this messy hack is required, because initialize_sprite calls operator[]
+		// which puts the sprite to the MRU list.
+		_spriteData[index].Flags |= SPRCACHEFLAG_LOCKED;
 
-	// TODO: this is ugly: asks the engine to convert the sprite using its own knowledge.
-	// And engine assigns new bitmap using SpriteCache::SubstituteBitmap().
-	// Perhaps change to the callback function pointer?
-	initialize_sprite(index);
+		// TODO: this is ugly: asks the engine to convert the sprite using its own knowledge.
+		// And engine assigns new bitmap using SpriteCache::SubstituteBitmap().
+		// Perhaps change to the callback function pointer?
+		initialize_sprite(index);
 
-	if (index != 0)  // leave sprite 0 locked
-		_spriteData[index].Flags &= ~SPRCACHEFLAG_LOCKED;
+		if (index != 0)  // leave sprite 0 locked
+			_spriteData[index].Flags &= ~SPRCACHEFLAG_LOCKED;
+	}
 
 	// we need to store this because the main program might
 	// alter spritewidth/height if it resizes stuff
@@ -445,7 +503,125 @@ size_t SpriteCache::LoadSprite(sprkey_t index) {
 	return size;
 }
 
+void SpriteCache::CompressSprite(sprkey_t index, Bitmap *image) {
+	const size_t size = image->GetWidth() * image->GetHeight() * image->GetBPP();
+	if (size == 0 || size / 2 > _maxCompressedSize)
+		return;
+
+	std::vector<char> data;
+	data.reserve(size + size / 8 + image->GetHeight() * 4);
+	{
+		MemoryStream out(data, kStream_Write);
+		rle_compress(image, &out);
+	}
+	// images which barely compress are better read from the file again
+	if (data.size() > size * 3 / 4 || data.size() > _maxCompressedSize)
+		return;
+
+	while (_compressedSize + data.size() > _maxCompressedSize && !_compressedList.empty())
+		DisposeOldestCompressed();
+
+	DisposeCompressed(index);
+	CompressedImage &comp = _spriteData[index].Compressed;
+	comp.Data = data; // copies without the spare capacity
+	comp.Width = image->GetWidth();
+	comp.Height = image->GetHeight();
+	comp.ColorDepth = image->GetColorDepth();
+	_compressedSize += comp.Data.size();
+	TouchCompressed(index);
+}
+
+void SpriteCache::TouchCompressed(sprkey_t index) {
+	// stale entries are only dropped when reached, so purge them occasionally
+	if ((size_t)_compressedList.size() > _spriteData.size() * 2) {
+		std::queue<CompressedRef> valid;
+		for (; !_compressedList.empty(); _compressedList.pop()) {
+			const CompressedRef &ref = _compressedList.front();
+			if (_spriteData[ref.Index].Compressed.Seq == ref.Seq)
+				valid.push(ref);
+		}
+		_compressedList = valid;
+	}
+
+	CompressedImage &comp = _spriteData[index].Compressed;
+	comp.Seq = ++_compressedSeq;
+	CompressedRef ref = { index, comp.Seq };
+	_compressedList.push(ref);
+}
+
+Bitmap *SpriteCache::RestoreCompressedSprite(sprkey_t index) {
+	const CompressedImage &comp = _spriteData[index].Compressed;
+	Bitmap *image = BitmapHelper::CreateBitmap(comp.Width, comp.Height, comp.ColorDepth);
+	if (!image) {
+		DisposeCompressed(index);
+		return nullptr;
+	}
+	// the copy stays valid, and is reused when the sprite is disposed again
+	MemoryStream in(comp.Data);
+	rle_decompress(image, &in);
+	TouchCompressed(index);
+
+#ifdef DEBUG_SPRITECACHE
+	Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Debug, "Restored compressed %d", index);
+#endif
+	return image;
+}
+
+void SpriteCache::DisposeCompressed(sprkey_t index) {
+	CompressedImage &comp = _spriteData[index].Compressed;
+	_compressedSize -= comp.Data.size();
+	comp = CompressedImage();
+}
+
+void SpriteCache::DisposeOldestCompressed() {
+	while (!_compressedList.empty()) {
+		CompressedRef ref = _compressedList.front();
+		_compressedList.pop();
+		if ((size_t)ref.Index < _spriteData.size() && _spriteData[ref.Index].Compressed.Seq == ref.Seq) {
+			DisposeCompressed(ref.Index);
+			_stats.CompressedEvictions++;
+			return;
+		}
+	}
+}
+
+void SpriteCache::PrefetchSprite(sprkey_t index) {
+	if (_maxCacheSize > 0 && DoesSpriteExist(index))
+		_prefetchList.push(index);
+}
+
+void SpriteCache::ClearPrefetch() {
+	_prefetchList.clear();
+}
+
+void SpriteCache::ProcessPrefetch(uint32_t budget_ms) {
+	const uint32_t start = g_system->getMillis();
+	while (!_prefetchList.empty()) {
+		// never push out the sprites in use to make room for prefetched ones
+		if (_cacheSize >= _maxCacheSize) {
+			ClearPrefetch();
+			return;
+		}
+
+		sprkey_t index = _prefetchList.front();
+		_prefetchList.pop();
+		if ((size_t)index >= _spriteData.size() || _spriteData[index].Image != nullptr ||
+		        !_spriteData[index].IsAssetSprite() || (_spriteData[index].Flags & SPRCACHEFLAG_REMAPPED) != 0)
+			continue;
+
+		// also puts the sprite into the MRU list
+		_prefetching = true;
+		(*this)[index];
+		_prefetching = false;
+		_stats.Prefetched++;
+
+		if (g_system->getMillis() - start >= budget_ms)
+			return;
+	}
+}
+
 void SpriteCache::RemapSpriteToSprite0(sprkey_t index) {
+	DisposeCompressed(index);
 	_sprInfos[index].Flags = _sprInfos[0].Flags;
 	_sprInfos[index].Width = _sprInfos[0].Width;
 	_sprInfos[index].Height = _sprInfos[0].Height;
@@ -42,6 +42,7 @@
 #define AGS_SHARED_AC_SPRITE_CACHE_H
 
 #include "ags/lib/std/memory.h"
+#include "ags/lib/std/queue.h"
 #include "ags/lib/std/vector.h"
 #include "ags/shared/core/platform.h"
 #include "ags/shared/util/error.h"
@@ -97,6 +98,16 @@ enum SpriteIndexFileVersion {
 
 typedef int32_t sprkey_t;
 
+// Sprite cache usage counters
+struct SpriteCacheStats {
+	uint32_t Hits = 0;           // requested sprite was already loaded
+	uint32_t Misses = 0;         // requested sprite had to be read from the sprite file
+	uint32_t CompressedHits = 0; // requested sprite was restored from its compressed copy
+	uint32_t Evictions = 0;      // loaded sprites disposed to free cache space
+	uint32_t CompressedEvictions = 0; // compressed copies dropped to free space
+	uint32_t Prefetched = 0;     // sprites loaded ahead of use, not counted as misses
+};
+
 // SpriteFileIndex contains sprite file's table of contents
 struct SpriteFileIndex {
 	int SpriteFileIDCheck = 0; // tag matching sprite file and index file
@@ -218,6 +229,22 @@ public:
 	void        SubstituteBitmap(sprkey_t index, Shared::Bitmap *);
 	// Sets max cache size in bytes
 	void        SetMaxCacheSize(size_t size);
+	// Returns current size of the compressed sprite copies, in bytes
+	size_t      GetCompressedSize() const;
+	// Returns maximal size limit of the compressed sprite copies, in bytes
+	size_t      GetMaxCompressedSize() const;
+	// Sets max size of the compressed sprite copies in bytes; 0 disables them
+	void        SetMaxCompressedSize(size_t size);
+	// Gets the cache usage counters
+	const SpriteCacheStats &GetStats() const;
+	void        ResetStats();
+
+	// Queues sprite to be loaded ahead of use by ProcessPrefetch
+	void        PrefetchSprite(sprkey_t index);
+	// Drops all the queued sprites
+	void        ClearPrefetch();
+	// Loads queued sprites until the time budget is spent or the cache is full
+	void        ProcessPrefetch(uint32_t budget_ms);
 
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Shared::Bitmap *operator[] (sprkey_t index);
@@ -231,15 +258,36 @@ private:
 	sprkey_t    GetDataIndex(sprkey_t index);
 	// Delete the oldest image in cache
 	void        DisposeOldest();
+	// Keeps a compressed copy of the sprite image which is being disposed
+	void        CompressSprite(sprkey_t index, Shared::Bitmap *image);
+	// Recreates the sprite image from its compressed copy
+	Shared::Bitmap *RestoreCompressedSprite(sprkey_t index);
+	// Moves compressed copy of the sprite to the back of the list, as the most recently used
+	void        TouchCompressed(sprkey_t index);
+	// Releases compressed copy of the sprite, if there's one
+	void        DisposeCompressed(sprkey_t index);
+	// Delete the oldest compressed copy
+	void        DisposeOldestCompressed();
 
 	// Information required for the sprite streaming
 	// TODO: split into sprite cache and sprite stream data
+	// RLE compressed copy of the disposed sprite image, which is much cheaper
+	// to restore than reading it from the file and initializing it again
+	struct CompressedImage {
+		std::vector<char> Data;
+		int             Width = 0;
+		int             Height = 0;
+		int             ColorDepth = 0;
+		uint32_t        Seq = 0; // matches the entry in the compressed list
+	};
+
 	struct SpriteData {
 		size_t          Size; // to track cache size
 		uint32_t        Flags;
 		// TODO: investigate if we may safely use unique_ptr here
 		// (some of these bitmaps may be assigned from outside of the cache)
 		Shared::Bitmap *Image; // actual bitmap
+		CompressedImage Compressed;
 
 		// Tells if there actually is a registered sprite in this slot
 		bool DoesSpriteExist() const;
@@ -273,6 +321,23 @@ private:
 	int _liststart;
 	int _listend;
 
+	// Compressed copies, in the order they were last used; entries which Seq
+	// no longer matches the sprite's copy are stale and skipped
+	struct CompressedRef {
+		sprkey_t Index;
+		uint32_t Seq;
+	};
+	std::queue<CompressedRef> _compressedList;
+	uint32_t _compressedSeq;
+	size_t _maxCompressedSize; // compressed copies size limit
+	size_t _compressedSize;    // size in bytes of the compressed copies
+
+	// Sprites waiting to be loaded ahead of use
+	std::queue<sprkey_t> _prefetchList;
+	bool _prefetching; // loading a sprite from the prefetch list
+
+	SpriteCacheStats _stats;
+
 	// Initialize the empty sprite slot
 	void        InitNullSpriteParams(sprkey_t index);
 };
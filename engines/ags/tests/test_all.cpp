@@ -28,6 +28,7 @@ void Test_DoAllTests() {
 	Test_Math();
 	Test_Memory();
 	Test_Path();
+	Test_Script();
 	Test_ScriptSprintf();
 	Test_String();
 	Test_Version();
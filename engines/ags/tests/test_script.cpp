@@ -0,0 +1,142 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "ags/shared/core/platform.h"
+#include "ags/shared/script/cc_options.h"
+#include "ags/shared/script/cc_script.h"
+#include "ags/shared/script/script_common.h"
+#include "ags/engine/script/cc_instance.h"
+
+namespace AGS3 {
+
+// Hand assembled byte-code, run with the decoded operation cache both
+// enabled and disabled; every function must give the same results.
+static const int32_t test_script_code[] = {
+	// int loop(int n): sum of 1..n, executing the loop body n times
+	SCMD_LOADSPOFFS, 8,                 //  0: MAR = &n
+	SCMD_MEMREAD, SREG_BX,              //  2: BX = n
+	SCMD_LITTOREG, SREG_CX, 0,          //  4: CX = 0
+	SCMD_REGTOREG, SREG_BX, SREG_AX,    //  7: AX = BX
+	SCMD_JZ, 8,                         // 10: if AX == 0 goto 20
+	SCMD_ADDREG, SREG_CX, SREG_BX,      // 12: CX += BX
+	SCMD_SUB, SREG_BX, 1,               // 15: BX -= 1
+	SCMD_JMP, -13,                      // 18: goto 7
+	SCMD_REGTOREG, SREG_CX, SREG_AX,    // 20: AX = CX
+	SCMD_RET,                           // 23
+	// int global(): adds 7 to a global variable and returns it
+	SCMD_LITTOREG, SREG_MAR, 0,         // 24: MAR = &global (fixed up)
+	SCMD_MEMREAD, SREG_AX,              // 27: AX = global
+	SCMD_ADD, SREG_AX, 7,               // 29: AX += 7
+	SCMD_MEMWRITE, SREG_AX,             // 32: global = AX
+	SCMD_RET,                           // 34
+	// int call(int n): returns loop(n * 2)
+	SCMD_LOADSPOFFS, 8,                 // 35: MAR = &n
+	SCMD_MEMREAD, SREG_AX,              // 37: AX = n
+	SCMD_MUL, SREG_AX, 2,               // 39: AX *= 2
+	SCMD_PUSHREG, SREG_AX,              // 42: push AX
+	SCMD_LITTOREG, SREG_BX, 0,          // 44: BX = loop (fixed up)
+	SCMD_CALL, SREG_BX,                 // 47: call BX
+	SCMD_SUB, SREG_SP, 4,               // 49: pop the argument
+	SCMD_RET                            // 52
+};
+
+static const int32_t test_script_fixups[] = { 26, 46 };
+static const char test_script_fixuptypes[] = { FIXUP_GLOBALDATA, FIXUP_FUNCTION };
+
+static const char *test_script_exports[] = { "loop$1", "global$0", "call$1" };
+static const int32_t test_script_export_addr[] = {
+	(EXPORT_FUNCTION << 24) | 0, (EXPORT_FUNCTION << 24) | 24, (EXPORT_FUNCTION << 24) | 35
+};
+
+static PScript CreateTestScript() {
+	PScript script(new ccScript());
+
+	script->globaldatasize = sizeof(int32_t);
+	script->globaldata = (char *)calloc(1, script->globaldatasize);
+	script->codesize = ARRAYSIZE(test_script_code);
+	script->code = (int32_t *)malloc(sizeof(test_script_code));
+	memcpy(script->code, test_script_code, sizeof(test_script_code));
+
+	script->numfixups = ARRAYSIZE(test_script_fixups);
+	script->fixups = (int32_t *)malloc(sizeof(test_script_fixups));
+	memcpy(script->fixups, test_script_fixups, sizeof(test_script_fixups));
+	script->fixuptypes = (char *)malloc(sizeof(test_script_fixuptypes));
+	memcpy(script->fixuptypes, test_script_fixuptypes, sizeof(test_script_fixuptypes));
+
+	// instances can't be created for scripts without imports
+	script->numimports = 1;
+	script->imports = (char **)calloc(1, sizeof(char *));
+
+	script->numexports = ARRAYSIZE(test_script_exports);
+	script->exports = (char **)malloc(sizeof(char *) * script->numexports);
+	script->export_addr = (int32_t *)malloc(sizeof(test_script_export_addr));
+	for (int i = 0; i < script->numexports; ++i) {
+		script->exports[i] = scumm_strdup(test_script_exports[i]);
+		script->export_addr[i] = test_script_export_addr[i];
+	}
+	return script;
+}
+
+static int RunTestFunction(ccInstance *inst, const char *name, int num_params, int param) {
+	RuntimeScriptValue params[1];
+	params[0].SetInt32(param);
+	int result = inst->CallScriptFunction(name, num_params, params);
+	assert(result == 0);
+	return inst->returnValue;
+}
+
+static void RunTestScript(PScript script, bool decode_cache, int *results) {
+	ccSetOption(SCOPT_NODECODECACHE, decode_cache ? 0 : 1);
+
+	ccInstance *inst = ccInstance::CreateFromScript(script);
+	assert(inst != nullptr);
+
+	results[0] = RunTestFunction(inst, "loop", 1, 100);
+	// run again, from the decoded operations this time
+	results[1] = RunTestFunction(inst, "loop", 1, 10);
+	results[2] = RunTestFunction(inst, "global", 0, 0);
+	results[3] = RunTestFunction(inst, "global", 0, 0);
+	results[4] = RunTestFunction(inst, "call", 1, 10);
+	results[5] = *(int32_t *)inst->globaldata;
+
+	delete inst;
+	ccSetOption(SCOPT_NODECODECACHE, 0);
+}
+
+void Test_Script() {
+	PScript script = CreateTestScript();
+
+	int cached[6], uncached[6];
+	RunTestScript(script, true, cached);
+	RunTestScript(script, false, uncached);
+
+	assert(cached[0] == 5050);
+	assert(cached[1] == 55);
+	assert(cached[2] == 7);
+	assert(cached[3] == 14);
+	assert(cached[4] == 210);
+	assert(cached[5] == 14);
+
+	for (int i = 0; i < ARRAYSIZE(cached); ++i)
+		assert(cached[i] == uncached[i]);
+}
+
+} // namespace AGS3
@@ -1067,6 +1067,10 @@ void BladeRunnerEngine::gameTick() {
 		_gameAutoSaveTextId = -1;
 	}
 
+	// Load a few queued animation pages per tick, so the frames of upcoming
+	// animations are resident before they are drawn
+	_sliceAnimations->prefetchPages(4);
+
 	//probably not needed, this version of tick is just loading data from buffer
 	//_audioMixer->tick();
 
@@ -44,6 +44,8 @@
 #include "bladerunner/settings.h"
 #include "bladerunner/set.h"
 #include "bladerunner/set_effects.h"
+#include "bladerunner/slice_animations.h"
+#include "bladerunner/slice_renderer.h"
 #include "bladerunner/text_resource.h"
 #include "bladerunner/time.h"
 #include "bladerunner/vector.h"
@@ -66,6 +68,7 @@
 
 #include "common/debug.h"
 #include "common/str.h"
+#include "common/system.h"
 
 #include "graphics/surface.h"
 
@@ -139,6 +142,8 @@ Debugger::Debugger(BladeRunnerEngine *vm) : GUI::Debugger() {
 	registerCmd("region", WRAP_METHOD(Debugger, cmdRegion));
 	registerCmd("mouse", WRAP_METHOD(Debugger, cmdMouse));
 	registerCmd("difficulty", WRAP_METHOD(Debugger, cmdDifficulty));
+	registerCmd("slicebench", WRAP_METHOD(Debugger, cmdSliceBench));
+	registerCmd("pagecache", WRAP_METHOD(Debugger, cmdPageCache));
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 	registerCmd("effect", WRAP_METHOD(Debugger, cmdEffect));
@@ -1963,6 +1968,119 @@ bool Debugger::cmdDifficulty(int argc, const char **argv) {
 	}
 	return true;
 }
+
+/**
+* Render every frame of an actor's current animation in its current pose
+* with the fast and the generic slice rasterizer, compare the results and
+* report the time taken by each.
+*/
+bool Debugger::cmdSliceBench(int argc, const char **argv) {
+	if (argc != 2 && argc != 3) {
+		debugPrintf("Benchmark slice rendering of an actor's current animation and verify that the fast path is bit-exact.\n");
+		debugPrintf("Usage: %s <actorId> [<iterations>]\n", argv[0]);
+		return true;
+	}
+
+	int actorId = atoi(argv[1]);
+
+	Actor *actor = nullptr;
+	if (actorId >= 0 && actorId < (int)_vm->_gameInfo->getActorCount()) {
+		actor = _vm->_actors[actorId];
+	}
+
+	if (actor == nullptr) {
+		debugPrintf("Unknown actor %i\n", actorId);
+		return true;
+	}
+
+	if (actor->getSetId() != _vm->_scene->getSetId()) {
+		debugPrintf("Actor %i is not in the current set\n", actorId);
+		return true;
+	}
+
+	int iterations = 10;
+	if (argc == 3) {
+		iterations = MAX(atoi(argv[2]), 1);
+	}
+
+	int animationId = actor->getAnimationId();
+	int frameCount = _vm->_sliceAnimations->getFrameCount(animationId);
+
+	// Same transformation as Actor::draw, with a fixed scale
+	Vector3 actorPosition = actor->getXYZ();
+	Vector3 position(actorPosition.x, -actorPosition.z, actorPosition.y + 2.0f);
+	float facing = M_PI - actor->getFacing() * (M_PI / 512.0f);
+
+	const uint zbufferSize = 640 * 480;
+	uint16 *zbufferScene = _vm->_zbuffer->getData();
+	uint16 *zbuffers[2];
+	Graphics::Surface surfaces[2];
+	uint32 elapsed[2] = { 0, 0 };
+
+	for (int i = 0; i < 2; ++i) {
+		zbuffers[i] = new uint16[zbufferSize];
+		surfaces[i].copyFrom(_vm->_surfaceBack);
+	}
+
+	int mismatches = 0;
+	for (int frame = 0; frame < frameCount; ++frame) {
+		for (int i = 0; i < 2; ++i) {
+			_vm->_sliceRenderer->setUseGenericSpans(i == 1);
+			// the z-buffer is reset each time so every iteration draws the same pixels
+			uint32 startTime = g_system->getMillis(true);
+			for (int j = 0; j < iterations; ++j) {
+				memcpy(zbuffers[i], zbufferScene, zbufferSize * sizeof(uint16));
+				_vm->_sliceRenderer->drawInWorld(animationId, frame, position, facing, 1.0f, surfaces[i], zbuffers[i]);
+			}
+			elapsed[i] += g_system->getMillis(true) - startTime;
+		}
+
+		if (memcmp(zbuffers[0], zbuffers[1], zbufferSize * sizeof(uint16)) != 0
+		 || memcmp(surfaces[0].getPixels(), surfaces[1].getPixels(), surfaces[0].pitch * surfaces[0].h) != 0
+		) {
+			++mismatches;
+		}
+	}
+	_vm->_sliceRenderer->setUseGenericSpans(false);
+
+	for (int i = 0; i < 2; ++i) {
+		delete[] zbuffers[i];
+		surfaces[i].free();
+	}
+
+	debugPrintf("Animation %i, %i frames x %i iterations\n", animationId, frameCount, iterations);
+	debugPrintf("Fast path:    %u ms\n", elapsed[0]);
+	debugPrintf("Generic path: %u ms\n", elapsed[1]);
+	if (mismatches == 0) {
+		debugPrintf("Output is bit-exact\n");
+	} else {
+		debugPrintf("Output differs in %i frames\n", mismatches);
+	}
+	return true;
+}
+
+/**
+* Show or reset the statistics of the slice animation page cache
+*/
+bool Debugger::cmdPageCache(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && scumm_stricmp(argv[1], "reset") != 0)) {
+		debugPrintf("Show or reset the slice animation page cache statistics.\n");
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	const SliceAnimations::PageCacheStats &stats = _vm->_sliceAnimations->getPageCacheStats();
+	debugPrintf("Resident pages: %u / %u\n", _vm->_sliceAnimations->getCachedPageCount(), _vm->_sliceAnimations->getMaxCachedPages());
+	debugPrintf("Page faults:    %u\n", stats.faults);
+	debugPrintf("Prefetched:     %u (%u used)\n", stats.prefetched, stats.prefetchHits);
+	debugPrintf("Evictions:      %u\n", stats.evictions);
+
+	if (argc == 2) {
+		_vm->_sliceAnimations->resetPageCacheStats();
+		debugPrintf("Statistics reset\n");
+	}
+	return true;
+}
 #if BLADERUNNER_ORIGINAL_BUGS
 #else
 bool Debugger::cmdEffect(int argc, const char **argv) {
@@ -34,6 +34,7 @@
 #include "bladerunner/screen_effects.h"
 #include "bladerunner/set.h"
 #include "bladerunner/settings.h"
+#include "bladerunner/slice_animations.h"
 #include "bladerunner/slice_renderer.h"
 #include "bladerunner/script/police_maze.h"
 #include "bladerunner/script/scene_script.h"
@@ -358,6 +359,7 @@ void Scene::loopStartSpecial(int specialLoopMode, int loopId, bool immediately)
 	if (_specialLoopMode == kSceneLoopModeChangeSet) {
 		_nextSetId = _vm->_settings->getNewSet();
 		_nextSceneId = _vm->_settings->getNewScene();
+		prefetchActorAnimations(_nextSetId);
 	}
 	if (immediately) {
 		_defaultLoopPreloadedSet = true;
@@ -365,6 +367,18 @@ void Scene::loopStartSpecial(int specialLoopMode, int loopId, bool immediately)
 	}
 }
 
+void Scene::prefetchActorAnimations(int setId) {
+	// Let the slice animation pages of actors waiting in the next set
+	// load while the exit loop is playing
+	int actorCount = _vm->_gameInfo->getActorCount();
+	for (int i = 0; i != actorCount; ++i) {
+		Actor *actor = _vm->_actors[i];
+		if (actor->getSetId() == setId && actor->getAnimationId() >= 0) {
+			_vm->_sliceAnimations->prefetchAnimation(actor->getAnimationId());
+		}
+	}
+}
+
 int Scene::findObject(const Common::String &objectName) {
 	return _set->findObject(objectName);
 }
@@ -98,6 +98,8 @@ public:
 private:
 	void loopEnded(int frame, int loopId);
 	static void loopEndedStatic(void *data, int frame, int loopId);
+
+	void prefetchActorAnimations(int setId);
 };
 
 } // End of namespace BladeRunner
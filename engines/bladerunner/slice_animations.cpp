@@ -22,7 +22,6 @@
 #include "bladerunner/slice_animations.h"
 
 #include "bladerunner/bladerunner.h"
-#include "bladerunner/time.h"
 
 #include "common/debug.h"
 #include "common/file.h"
@@ -30,6 +29,9 @@
 
 namespace BladeRunner {
 
+// Memory budget for resident animation pages (64 KB each in the original data)
+static const uint32 kPageCacheSize = 32 * 1024 * 1024;
+
 bool SliceAnimations::open(const Common::String &name) {
 	Common::File file;
 	if (!file.open(_vm->getResourceStream(name), name))
@@ -80,6 +82,8 @@ bool SliceAnimations::open(const Common::String &name) {
 	for (uint32 i = 0; i != _pageCount; ++i)
 		_pages[i]._data = nullptr;
 
+	_maxCachedPages = MAX<uint32>(kPageCacheSize / _pageSize, 1);
+
 	return true;
 }
 
@@ -219,8 +223,6 @@ void *SliceAnimations::PageFile::loadPage(uint32 pageNumber) {
 
 	uint32 pageSize = _sliceAnimations->_pageSize;
 
-	// TODO: Retire oldest pages if we exceed some memory limit
-
 	void *data = malloc(pageSize);
 	_files[_pageOffsetsFileIdx[pageNumber]].seek(_pageOffsets[pageNumber], SEEK_SET);
 	uint32 r = _files[_pageOffsetsFileIdx[pageNumber]].read(data, pageSize);
@@ -257,21 +259,120 @@ void *SliceAnimations::getFramePtr(uint32 animation, uint32 frame) {
 	uint32 page        = frameOffset / _pageSize;
 	uint32 pageOffset  = frameOffset % _pageSize;
 
-	if (_pages[page]._data == nullptr) {                          // if not cached already
-		_pages[page]._data = _coreAnimPageFile.loadPage(page);    // look in COREANIM first
+	if (_pages[page]._data == nullptr) { // if not cached already
+		++_stats.faults;
+		if (!loadPage(page)) {
+			error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
+		}
+	} else if (_lruHead != (int32)page) {
+		unlinkPage(page);
+		linkPage(page);
+	}
 
-		if (_pages[page]._data == nullptr) {                      // if not in COREAMIM
-			_pages[page]._data = _framesPageFile.loadPage(page);  // Look in CDFRAMES or HDFRAMES loaded data
+	if (_pages[page]._prefetched) {
+		_pages[page]._prefetched = false;
+		++_stats.prefetchHits;
+	}
 
-			if (_pages[page]._data == nullptr) {
-				error("Unable to locate page %d for animation %d frame %d", page, animation, frame);
-			}
+	return (byte *)_pages[page]._data + pageOffset;
+}
+
+void SliceAnimations::prefetchAnimation(int animation) {
+	if (animation < 0 || animation >= (int)_animations.size() || _animations[animation].frameCount == 0) {
+		return;
+	}
+
+	const Animation &anim = _animations[animation];
+	uint32 firstPage = anim.offset / _pageSize;
+	uint32 lastPage  = (anim.offset + anim.frameCount * anim.frameSize - 1) / _pageSize;
+
+	for (uint32 page = firstPage; page <= lastPage && page < _pageCount; ++page) {
+		// Keep the queue well below the cache size, otherwise prefetched
+		// pages would start evicting each other before they are used
+		if ((uint32)_prefetchQueue.size() >= _maxCachedPages / 2) {
+			return;
+		}
+		if (_pages[page]._data == nullptr && !_pages[page]._queued) {
+			_pages[page]._queued = true;
+			_prefetchQueue.push(page);
 		}
 	}
+}
 
-	_pages[page]._lastAccess = _vm->_time->currentSystem();
+void SliceAnimations::prefetchPages(uint32 pageCount) {
+	while (pageCount > 0 && !_prefetchQueue.empty()) {
+		uint32 page = _prefetchQueue.pop();
+		_pages[page]._queued = false;
 
-	return (byte *)_pages[page]._data + pageOffset;
+		// already loaded by an access, or not available in the open files
+		if (_pages[page]._data != nullptr || !loadPage(page)) {
+			continue;
+		}
+
+		_pages[page]._prefetched = true;
+		++_stats.prefetched;
+		--pageCount;
+	}
+}
+
+bool SliceAnimations::loadPage(uint32 page) {
+	void *data = _coreAnimPageFile.loadPage(page); // look in COREANIM first
+	if (data == nullptr) {                         // if not in COREAMIM
+		data = _framesPageFile.loadPage(page);     // Look in CDFRAMES or HDFRAMES loaded data
+	}
+	if (data == nullptr) {
+		return false;
+	}
+
+	// Only make room once the new page is there, a failed read keeps the cache intact
+	if (_cachedPageCount >= _maxCachedPages) {
+		evictPage();
+	}
+
+	_pages[page]._data = data;
+	linkPage(page);
+	++_cachedPageCount;
+	return true;
+}
+
+void SliceAnimations::evictPage() {
+	if (_lruTail == -1) {
+		return;
+	}
+
+	uint32 page = _lruTail;
+	unlinkPage(page);
+	free(_pages[page]._data);
+	_pages[page]._data = nullptr;
+	_pages[page]._prefetched = false;
+	--_cachedPageCount;
+	++_stats.evictions;
+}
+
+void SliceAnimations::linkPage(uint32 page) {
+	_pages[page]._prev = -1;
+	_pages[page]._next = _lruHead;
+	if (_lruHead != -1) {
+		_pages[_lruHead]._prev = page;
+	} else {
+		_lruTail = page;
+	}
+	_lruHead = page;
+}
+
+void SliceAnimations::unlinkPage(uint32 page) {
+	if (_pages[page]._prev != -1) {
+		_pages[_pages[page]._prev]._next = _pages[page]._next;
+	} else {
+		_lruHead = _pages[page]._next;
+	}
+	if (_pages[page]._next != -1) {
+		_pages[_pages[page]._next]._prev = _pages[page]._prev;
+	} else {
+		_lruTail = _pages[page]._prev;
+	}
+	_pages[page]._prev = -1;
+	_pages[page]._next = -1;
 }
 
 Vector3 SliceAnimations::getPositionChange(int animation) const {
@@ -24,6 +24,7 @@
 
 #include "common/array.h"
 #include "common/file.h"
+#include "common/queue.h"
 #include "common/str.h"
 #include "common/types.h"
 
@@ -57,11 +58,26 @@ class SliceAnimations {
 
 	struct Page {
 		void   *_data;
-		uint32 _lastAccess;
+		int32  _prev;       // more recently used resident page, -1 if none
+		int32  _next;       // less recently used resident page, -1 if none
+		bool   _queued;     // waiting in the prefetch queue
+		bool   _prefetched; // loaded by the prefetcher and not accessed since
 
-		Page() : _data(nullptr), _lastAccess(0) {}
+		Page() : _data(nullptr), _prev(-1), _next(-1), _queued(false), _prefetched(false) {}
 	};
 
+public:
+	struct PageCacheStats {
+		uint32 faults;         // pages loaded synchronously on access
+		uint32 prefetched;     // pages loaded ahead of time by the prefetcher
+		uint32 prefetchHits;   // prefetched pages which were accessed later
+		uint32 evictions;      // pages dropped to stay within the cache size
+
+		PageCacheStats() : faults(0), prefetched(0), prefetchHits(0), evictions(0) {}
+	};
+
+private:
+
 	struct PageFile {
 		int                  _fileNumber;
 		SliceAnimations     *_sliceAnimations;
@@ -87,9 +103,23 @@ class SliceAnimations {
 	Common::Array<Animation>    _animations;
 	Common::Array<Page>         _pages;
 
+	// Resident pages, from most to least recently used
+	int32  _lruHead;
+	int32  _lruTail;
+	uint32 _cachedPageCount;
+	uint32 _maxCachedPages;
+
+	Common::Queue<uint32> _prefetchQueue;
+	PageCacheStats        _stats;
+
 	PageFile _coreAnimPageFile;
 	PageFile _framesPageFile;
 
+	bool loadPage(uint32 page);
+	void evictPage();
+	void linkPage(uint32 page);
+	void unlinkPage(uint32 page);
+
 public:
 	SliceAnimations(BladeRunnerEngine *vm)
 		: _vm(vm)
@@ -98,7 +128,11 @@ public:
 		, _timestamp(0)
 		, _pageSize(0)
 		, _pageCount(0)
-		, _paletteCount(0) {}
+		, _paletteCount(0)
+		, _lruHead(-1)
+		, _lruTail(-1)
+		, _cachedPageCount(0)
+		, _maxCachedPages(0) {}
 	~SliceAnimations();
 
 	bool open(const Common::String &name);
@@ -109,6 +143,16 @@ public:
 	Palette &getPalette(int i) { return _palettes[i]; };
 	void    *getFramePtr(uint32 animation, uint32 frame);
 
+	// Queue the pages of all frames of an animation to be loaded by prefetchPages()
+	void prefetchAnimation(int animation);
+	// Load up to pageCount queued pages
+	void prefetchPages(uint32 pageCount);
+
+	const PageCacheStats &getPageCacheStats() const { return _stats; }
+	uint32 getCachedPageCount() const { return _cachedPageCount; }
+	uint32 getMaxCachedPages() const { return _maxCachedPages; }
+	void   resetPageCacheStats() { _stats = PageCacheStats(); }
+
 	int   getFrameCount(int animation) const { return _animations[animation].frameCount; }
 	float getFPS(int animation) const { return _animations[animation].fps; }
 
@@ -33,6 +33,18 @@
 
 namespace BladeRunner {
 
+// Z-tests and fills one span of a slice line with a constant depth and colour.
+// Written without branches so the compiler can turn it into vector
+// compare/blend instructions.
+template<typename PixelType>
+static inline void fillSpan(PixelType *dst, uint16 *zbuffer, int count, uint16 z, PixelType color) {
+	for (int i = 0; i < count; ++i) {
+		bool visible = z < zbuffer[i];
+		zbuffer[i] = visible ? z : zbuffer[i];
+		dst[i] = visible ? color : dst[i];
+	}
+}
+
 SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_vm = vm;
 	_pixelFormat = screenPixelFormat();
@@ -61,6 +73,8 @@ SliceRenderer::SliceRenderer(BladeRunnerEngine *vm) {
 	_m13               = 0;
 	_m23               = 0;
 
+	_useGenericSpans = false;
+
 	_shadowPolygonDefault[ 0] = Vector3( 16.0f,  96.0f, 0.0f);
 	_shadowPolygonDefault[ 1] = Vector3( 16.0f, 160.0f, 0.0f);
 	_shadowPolygonDefault[ 2] = Vector3( 64.0f, 192.0f, 0.0f);
@@ -544,6 +558,18 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 
 	SliceAnimations::Palette &palette = _vm->_sliceAnimations->getPalette(_framePaletteIndex);
 
+	// Spans are clipped to [0, 640], so whole rows of that width can be
+	// filled directly; anything else goes through the clipped per-pixel path.
+	uint16 *dstLine16 = nullptr;
+	uint32 *dstLine32 = nullptr;
+	if (!_useGenericSpans && surface.w >= 640 && y >= 0 && y < surface.h) {
+		if (surface.format.bytesPerPixel == 2) {
+			dstLine16 = (uint16 *)surface.getBasePtr(0, y);
+		} else if (surface.format.bytesPerPixel == 4) {
+			dstLine32 = (uint32 *)surface.getBasePtr(0, y);
+		}
+	}
+
 	byte *p = (byte *)_sliceFramePtr + 0x20 + 4 * slice;
 
 	uint32 polyOffset = READ_LE_UINT32(p);
@@ -585,12 +611,18 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufferLine[x]) {
-							zbufferLine[x] = (uint16)vertexZ;
-
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
+					if (dstLine16) {
+						fillSpan(dstLine16 + previousVertexX, zbufferLine + previousVertexX, vertexX - previousVertexX, (uint16)vertexZ, (uint16)outColor);
+					} else if (dstLine32) {
+						fillSpan(dstLine32 + previousVertexX, zbufferLine + previousVertexX, vertexX - previousVertexX, (uint16)vertexZ, outColor);
+					} else {
+						for (int x = previousVertexX; x != vertexX; ++x) {
+							if (vertexZ < zbufferLine[x]) {
+								zbufferLine[x] = (uint16)vertexZ;
+
+								void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
+								drawPixel(surface, dstPtr, outColor);
+							}
 						}
 					}
 				}
@@ -743,10 +775,8 @@ void SliceRenderer::drawShadowPolygon(int transparency, Graphics::Surface &surfa
 }
 
 void SliceRenderer::preload(int animationId) {
-	int frameCount = _vm->_sliceAnimations->getFrameCount(animationId);
-	for (int i = 0; i < frameCount; ++i) {
-		_vm->_sliceAnimations->getFramePtr(animationId, i);
-	}
+	// Pages are loaded over the next ticks instead of stalling the scene setup
+	_vm->_sliceAnimations->prefetchAnimation(animationId);
 }
 
 void SliceRenderer::disableShadows(int animationsIdsList[], int listSize) {
@@ -90,6 +90,8 @@ class SliceRenderer {
 
 	Graphics::PixelFormat _pixelFormat;
 
+	bool _useGenericSpans;
+
 public:
 	SliceRenderer(BladeRunnerEngine *vm);
 	~SliceRenderer();
@@ -108,6 +110,9 @@ public:
 
 	void disableShadows(int *animationsIdsList, int listSize);
 
+	// Forces the per-pixel span path; used by the debugger to verify the fast path
+	void setUseGenericSpans(bool useGenericSpans) { _useGenericSpans = useGenericSpans; }
+
 private:
 	void calculateBoundingRect();
 	Matrix3x2 calculateFacingRotationMatrix();
@@ -141,6 +141,7 @@ VQADecoder::VQADecoder() {
 VQADecoder::~VQADecoder() {
 	for (uint i = _codebooks.size(); i != 0; --i) {
 		delete[] _codebooks[i - 1].data;
+		delete[] _codebooks[i - 1].pixels;
 	}
 	delete _audioTrack;
 	delete _videoTrack;
@@ -467,6 +468,7 @@ bool VQADecoder::readCINF(Common::SeekableReadStream *s, uint32 size) {
 		_codebooks[codebookCount - i].frame = s->readUint16LE();
 		_codebooks[codebookCount - i].size  = s->readUint32LE();
 		_codebooks[codebookCount - i].data  = nullptr;
+		_codebooks[codebookCount - i].pixels = nullptr;
 
 		// debug("Codebook %2u: %4d %8d", codebookCount - i, _codebooks[codebookCount - i].frame, _codebooks[codebookCount - i].size);
 
@@ -606,8 +608,9 @@ VQADecoder::VQAVideoTrack::VQAVideoTrack(VQADecoder *vqaDecoder) {
 	_maxCBFZSize = header->maxCBFZSize;
 	_maxZBUFChunkSize = vqaDecoder->_maxZBUFChunkSize;
 
-	_codebook = nullptr;
-	_cbfz     = nullptr;
+	_codebook       = nullptr;
+	_codebookPixels = nullptr;
+	_cbfz           = nullptr;
 
 	_vpointerSize = 0;
 	_vpointer = nullptr;
@@ -828,11 +831,78 @@ bool VQADecoder::VQAVideoTrack::readVPTR(Common::SeekableReadStream *s, uint32 s
 	return true;
 }
 
+void VQADecoder::VQAVideoTrack::convertCodebook(CodebookInfo &codebookInfo, const Graphics::PixelFormat &format) {
+	uint32 pixelCount = _maxBlocks * _blockW * _blockH;
+
+	delete[] codebookInfo.pixels;
+	codebookInfo.pixels = new uint8[pixelCount * format.bytesPerPixel];
+	codebookInfo.pixelsFormat = format;
+
+	const uint8 *src_p = codebookInfo.data;
+	uint8 a, r, g, b;
+
+	for (uint32 i = 0; i != pixelCount; ++i) {
+		getGameDataColor(READ_LE_UINT16(src_p + 2 * i), a, r, g, b);
+		// Ignore the alpha in the output as it is inversed in the input
+		uint32 color = format.RGBToColor(r, g, b);
+		if (format.bytesPerPixel == 2) {
+			((uint16 *)codebookInfo.pixels)[i] = (uint16)color;
+		} else {
+			((uint32 *)codebookInfo.pixels)[i] = color;
+		}
+	}
+}
+
 void VQADecoder::VQAVideoTrack::VPTRWriteBlock(Graphics::Surface *surface, unsigned int dstBlock, unsigned int srcBlock, int count, bool alpha) {
 	const uint8 *const block_src = &_codebook[2 * srcBlock * _blockW * _blockH];
 
 	uint16 blocks_per_line = _width / _blockW;
 
+	if (_codebookPixels) {
+		// Codebook already converted to the surface format, copy whole block rows
+		const uint bpp = surface->format.bytesPerPixel;
+		const uint rowSize = _blockW * bpp;
+		const uint8 *const block_pixels = &_codebookPixels[srcBlock * _blockW * _blockH * bpp];
+
+		for (uint i = 0; i != (uint)count; ++i) {
+			uint32 block = dstBlock + i;
+			uint32 block_y = block / blocks_per_line;
+			uint32 block_x = block - block_y * blocks_per_line;
+
+			uint8 *dst_p = (uint8 *)surface->getBasePtr(block_x * _blockW + _offsetX, block_y * _blockH + _offsetY);
+			const uint8 *src_p = block_pixels;
+
+			if (alpha) {
+				const uint8 *alpha_p = block_src;
+				for (uint y = 0; y != _blockH; ++y) {
+					for (uint x = 0; x != _blockW; ++x) {
+						if (!(READ_LE_UINT16(alpha_p) & 0x8000)) {
+							memcpy(dst_p + x * bpp, src_p + x * bpp, bpp);
+						}
+						alpha_p += 2;
+					}
+					dst_p += surface->pitch;
+					src_p += rowSize;
+				}
+			} else if (rowSize == 16 && _blockH == 2) {
+				// The usual 4x2 blocks on 32-bit surfaces, fixed size copies become plain vector moves
+				memcpy(dst_p, src_p, 16);
+				memcpy(dst_p + surface->pitch, src_p + 16, 16);
+			} else if (rowSize == 8 && _blockH == 2) {
+				// 4x2 blocks on 16-bit surfaces
+				memcpy(dst_p, src_p, 8);
+				memcpy(dst_p + surface->pitch, src_p + 8, 8);
+			} else {
+				for (uint y = 0; y != _blockH; ++y) {
+					memcpy(dst_p, src_p, rowSize);
+					dst_p += surface->pitch;
+					src_p += rowSize;
+				}
+			}
+		}
+		return;
+	}
+
 	uint32 intermDiv = 0;
 	uint32 dst_x = 0;
 	uint32 dst_y = 0;
@@ -876,6 +946,14 @@ bool VQADecoder::VQAVideoTrack::decodeFrame(Graphics::Surface *surface) {
 	if (!_codebook || !_vpointer)
 		return false;
 
+	_codebookPixels = nullptr;
+	if (surface->format.bytesPerPixel == 2 || surface->format.bytesPerPixel == 4) {
+		if (!codebookInfo.pixels || codebookInfo.pixelsFormat != surface->format) {
+			convertCodebook(codebookInfo, surface->format);
+		}
+		_codebookPixels = codebookInfo.pixels;
+	}
+
 	uint8 *src = _vpointer;
 	uint8 *end = _vpointer + _vpointerSize;
 
@@ -80,6 +80,7 @@ DirectorEngine::DirectorEngine(OSystem *syst, const DirectorGameDescription *gam
 	_windowList = new Datum;
 	_windowList->type = ARRAY;
 	_windowList->u.farr = new FArray;
+	_windowList->initRefCount();
 	_currentWindow = nullptr;
 	_cursorWindow = nullptr;
 	_lingo = nullptr;
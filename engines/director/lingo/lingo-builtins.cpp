@@ -862,6 +862,7 @@ void LB::b_list(int nargs) {
 	Datum result;
 	result.type = ARRAY;
 	result.u.farr = new FArray;
+	result.initRefCount();
 
 	for (int i = 0; i < nargs; i++)
 		result.u.farr->arr.insert_at(0, g_lingo->pop());
@@ -1304,6 +1305,7 @@ void LB::b_play(int nargs) {
 	case 0:
 		frame.type = SYMBOL;
 		frame.u.s = new Common::String("done");
+		frame.initRefCount();
 		break;
 	default:
 		warning("b_play: expected 0, 1 or 2 args, not %d", nargs);
@@ -2328,6 +2330,7 @@ void LB::b_point(int nargs) {
 	Datum d;
 
 	d.u.farr = new FArray;
+	d.initRefCount();
 
 	d.u.farr->arr.push_back(x);
 	d.u.farr->arr.push_back(y);
@@ -2346,6 +2349,7 @@ void LB::b_rect(int nargs) {
 		Datum left(g_lingo->pop().asInt());
 
 		d.u.farr = new FArray;
+		d.initRefCount();
 		d.u.farr->arr.push_back(left);
 		d.u.farr->arr.push_back(top);
 		d.u.farr->arr.push_back(right);
@@ -2357,6 +2361,7 @@ void LB::b_rect(int nargs) {
 
 		if (p2.type == POINT && p1.type == POINT) {
 			d.u.farr = new FArray;
+			d.initRefCount();
 			d.u.farr->arr.push_back(p1.u.farr->arr[0]);
 			d.u.farr->arr.push_back(p1.u.farr->arr[1]);
 			d.u.farr->arr.push_back(p2.u.farr->arr[0]);
@@ -2724,6 +2729,7 @@ void LB::b_getVolumes(int nargs) {
 	Datum d;
 	d.type = ARRAY;
 	d.u.farr = new FArray;
+	d.initRefCount();
 	d.u.farr->arr.push_back(Datum("Buried in Time\252 1"));
 
 	g_lingo->push(d);
@@ -507,6 +507,7 @@ void LC::cb_proplist() {
 	Datum result;
 	result.type = PARRAY;
 	result.u.parr = new PArray;
+	result.initRefCount();
 	arraySize /= 2;
 
 	for (int i = 0; i < arraySize; i++) {
@@ -1099,6 +1100,7 @@ ScriptContext *LingoCompiler::compileLingoV4(Common::SeekableReadStreamEndian &s
 				}
 				constant.type = STRING;
 				constant.u.s = new Common::String(archive->cast->decodeString(str), Common::kUtf8);
+				constant.initRefCount();
 			}
 			break;
 		case 4: // Integer type
@@ -189,7 +189,7 @@ void Lingo::cleanupFuncs() {
 }
 
 void Lingo::push(Datum d) {
-	_stack.push_back(d);
+	_stack.push_back(static_cast<Datum &&>(d));
 }
 
 void Lingo::pushVoid() {
@@ -202,7 +202,7 @@ void Lingo::pushVoid() {
 Datum Lingo::pop() {
 	assert (_stack.size() != 0);
 
-	Datum ret = _stack.back();
+	Datum ret = static_cast<Datum &&>(_stack.back());
 	_stack.pop_back();
 
 	return ret;
@@ -464,6 +464,7 @@ void LC::c_arraypush() {
 
 	d.type = ARRAY;
 	d.u.farr = new FArray;
+	d.initRefCount();
 
 	for (int i = 0; i < arraySize; i++)
 		d.u.farr->arr.insert_at(0, g_lingo->pop());
@@ -477,6 +478,7 @@ void LC::c_proparraypush() {
 
 	d.type = PARRAY;
 	d.u.parr = new PArray;
+	d.initRefCount();
 
 	for (int i = 0; i < arraySize; i++) {
 		Datum v = g_lingo->pop();
@@ -654,6 +656,7 @@ Datum LC::mapBinaryOp(Datum (*mapFunc)(Datum &, Datum &), Datum &d1, Datum &d2)
 	Datum res;
 	res.type = ARRAY;
 	res.u.farr = new FArray(arraySize);
+	res.initRefCount();
 	Datum a = d1;
 	Datum b = d2;
 	for (uint i = 0; i < arraySize; i++) {
@@ -802,6 +805,7 @@ Datum LC::negateData(Datum &d) {
 		Datum res;
 		res.type = ARRAY;
 		res.u.farr = new FArray(arraySize);
+		res.initRefCount();
 		for (uint i = 0; i < arraySize; i++) {
 			res.u.farr->arr[i] = LC::negateData(d.u.farr->arr[i]);
 		}
@@ -1052,6 +1056,7 @@ Datum LC::chunkRef(ChunkType type, int startChunk, int endChunk, const Datum &sr
 
 	Datum res;
 	res.u.cref = new ChunkReference(src, type, startChunk, endChunk, exprStartIdx, exprEndIdx);
+	res.initRefCount();
 	res.type = CHUNKREF;
 	return res;
 }
@@ -1690,6 +1695,7 @@ void LC::c_delete() {
 	}
 	Datum s;
 	s.u.s = new Common::String(res, Common::kUtf8);
+	s.initRefCount();
 	s.type = STRING;
 	g_lingo->varAssign(field, s);
 }
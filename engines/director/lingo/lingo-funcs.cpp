@@ -283,6 +283,7 @@ void Lingo::func_play(Datum &frame, Datum &movie) {
 		} else {
 			m.type = STRING;
 			m.u.s = new Common::String(ref.movie);
+			m.initRefCount();
 		}
 
 		f.type = INT;
@@ -635,6 +635,7 @@ Datum CastMember::getField(int field) {
 	case kTheCastType:
 		d.type = SYMBOL;
 		d.u.s = new Common::String(castTypeToString(_type));
+		d.initRefCount();
 		break;
 	case kTheFileName:
 		if (castInfo)
@@ -939,6 +940,7 @@ Datum TextCastMember::getField(int field) {
 		break;
 	case kTheTextAlign:
 		d.type = STRING;
+		d.initRefCount();
 		switch (_textAlign) {
 		case kTextAlignLeft:
 			d.u.s = new Common::String("left");
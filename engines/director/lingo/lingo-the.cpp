@@ -405,6 +405,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 		break;
 	case kTheClickLoc:
 		d.u.farr = new FArray;
+		d.initRefCount();
 
 		d.u.farr->arr.push_back(movie->_lastClickPos.x);
 		d.u.farr->arr.push_back(movie->_lastClickPos.y);
@@ -460,6 +461,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 	case kTheFrameLabel:
 		d.type = STRING;
 		d.u.s = score->getFrameLabel(score->getCurrentFrame());
+		d.initRefCount();
 		break;
 	case kTheFrameScript:
 		getTheEntitySTUB(kTheFrameScript);
@@ -490,11 +492,13 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 			Common::U32String ch(g_lingo->_itemDelimiter);
 			d.type = STRING;
 			d.u.s = new Common::String(ch, Common::kUtf8);
+			d.initRefCount();
 		}
 		break;
 	case kTheKey:
 		d.type = STRING;
 		d.u.s = new Common::String(movie->_key);
+		d.initRefCount();
 		break;
 	case kTheKeyCode:
 		d.type = INT;
@@ -502,6 +506,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 		break;
 	case kTheKeyDownScript:
 		d.type = STRING;
+		d.initRefCount();
 		if (mainArchive->primaryEventHandlers.contains(kEventKeyDown))
 			d.u.s = new Common::String(mainArchive->primaryEventHandlers[kEventKeyDown]);
 		else
@@ -509,6 +514,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 		break;
 	case kTheKeyUpScript:
 		d.type = STRING;
+		d.initRefCount();
 		if (mainArchive->primaryEventHandlers.contains(kEventKeyUp))
 			d.u.s = new Common::String(mainArchive->primaryEventHandlers[kEventKeyUp]);
 		else
@@ -517,6 +523,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 	case kTheLabelList:
 		d.type = STRING;
 		d.u.s = score->getLabelList();
+		d.initRefCount();
 		break;
 	case kTheLastClick:
 		d.type = INT;
@@ -628,6 +635,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 		break;
 	case kTheMouseDownScript:
 		d.type = STRING;
+		d.initRefCount();
 		if (mainArchive->primaryEventHandlers.contains(kEventMouseDown))
 			d.u.s = new Common::String(mainArchive->primaryEventHandlers[kEventMouseDown]);
 		else
@@ -661,6 +669,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 		break;
 	case kTheMouseUpScript:
 		d.type = STRING;
+		d.initRefCount();
 		if (mainArchive->primaryEventHandlers.contains(kEventMouseUp))
 			d.u.s = new Common::String(mainArchive->primaryEventHandlers[kEventMouseUp]);
 		else
@@ -684,6 +693,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 	case kTheMovieName:
 		d.type = STRING;
 		d.u.s = new Common::String(movie->getMacName());
+		d.initRefCount();
 		break;
 	case kTheMovieFileFreeSize:
 		d.type = INT;
@@ -697,6 +707,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 	case kThePathName:
 		d.type = STRING;
 		d.u.s = new Common::String(_vm->getCurrentPath());
+		d.initRefCount();
 		break;
 	case kTheMultiSound:
 		// We always support multiple sound channels!
@@ -761,6 +772,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 			if (channel->_widget) {
 				d.type = STRING;
 				d.u.s = new Common::String(Common::convertFromU32String(((Graphics::MacText *)channel->_widget)->getSelection()));
+				d.initRefCount();
 			}
 		}
 		break;
@@ -867,6 +879,7 @@ Datum Lingo::getTheEntity(int entity, Datum &id, int field) {
 		break;
 	case kTheTimeoutScript:
 		d.type = STRING;
+		d.initRefCount();
 		if (mainArchive->primaryEventHandlers.contains(kEventTimeout))
 			d.u.s = new Common::String(mainArchive->primaryEventHandlers[kEventTimeout]);
 		else
@@ -1165,10 +1178,12 @@ Datum Lingo::getTheMenuItemEntity(int entity, Datum &menuId, int field, Datum &m
 		if (menuId.type == STRING && menuItemId.type == STRING) {
 			d.type = STRING;
 			d.u.s = new Common::String;
+			d.initRefCount();
 			*(d.u.s) = g_director->_wm->getMenuItemName(menuId.asString(), menuItemId.asString());
 		} else if (menuId.type == INT && menuItemId.type == INT) {
 			d.type = STRING;
 			d.u.s = new Common::String;
+			d.initRefCount();
 			*(d.u.s) = g_director->_wm->getMenuItemName(menuId.asInt(), menuItemId.asInt());
 		} else
 			warning("Lingo::getTheMenuItemEntity(): Unprocessed setting field \"%s\" of entity %s", field2str(field), entity2str(entity));
@@ -1310,6 +1325,7 @@ Datum Lingo::getTheSprite(Datum &id1, int field) {
 	case kTheLoc:
 		d.type = POINT;
 		d.u.farr = new FArray;
+		d.initRefCount();
 		d.u.farr->arr.push_back(channel->_currentPoint.x);
 		d.u.farr->arr.push_back(channel->_currentPoint.y);
 		break;
@@ -1341,6 +1357,7 @@ Datum Lingo::getTheSprite(Datum &id1, int field) {
 		// let compiler to optimize this
 		d.type = RECT;
 		d.u.farr = new FArray;
+		d.initRefCount();
 		d.u.farr->arr.push_back(channel->getBbox().left);
 		d.u.farr->arr.push_back(channel->getBbox().top);
 		d.u.farr->arr.push_back(channel->getBbox().right);
@@ -1981,6 +1998,7 @@ Datum Lingo::getTheDate(int field) {
 	}
 
 	d.u.s = new Common::String(s);
+	d.initRefCount();
 
 	return d;
 }
@@ -2005,6 +2023,7 @@ Datum Lingo::getTheTime(int field) {
 	}
 
 	d.u.s = new Common::String(s);
+	d.initRefCount();
 
 	return d;
 }
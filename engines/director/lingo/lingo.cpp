@@ -21,6 +21,7 @@
 
 #include "common/file.h"
 #include "common/config-manager.h"
+#include "common/system.h"
 
 #include "graphics/macgui/macwindowmanager.h"
 
@@ -170,6 +171,7 @@ Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 
 	_windowList.type = ARRAY;
 	_windowList.u.farr = new FArray;
+	_windowList.initRefCount();
 
 	_compiler = new LingoCompiler;
 
@@ -423,7 +425,6 @@ void Lingo::execute() {
 				break;
 		}
 
-		Common::String instr = decodeInstruction(_currentScript, _pc);
 		uint current = _pc;
 
 		if (debugChannelSet(5, kDebugLingoExec))
@@ -436,7 +437,11 @@ void Lingo::execute() {
 				debug("me: %s", _currentMe.asString(true).c_str());
 		}
 
-		debugC(3, kDebugLingoExec, "[%3d]: %s", current, instr.c_str());
+		// Decoding is expensive, so only do it when the result gets printed
+		if (debugChannelSet(3, kDebugLingoExec)) {
+			Common::String instr = decodeInstruction(_currentScript, _pc);
+			debugC(3, kDebugLingoExec, "[%3d]: %s", current, instr.c_str());
+		}
 
 		_pc++;
 		(*((*_currentScript)[_pc - 1]))();
@@ -588,27 +593,59 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool numsOnly) {
 	return opType;
 }
 
+// Datums without data of their own, like VOID and plain numbers, are not
+// reference counted. This saves a heap allocation for every such value
+// pushed on the Lingo stack.
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 }
 
 Datum::Datum(const Datum &d) {
+	// Shared data must have been given a reference count when it was created
+	assert(d.refCount || !d.ownsData());
 	type = d.type;
 	u = d.u;
 	refCount = d.refCount;
-	*refCount += 1;
+	if (refCount)
+		*refCount += 1;
+}
+
+Datum::Datum(Datum &&d) {
+	type = d.type;
+	u = d.u;
+	refCount = d.refCount;
+
+	// Leave an empty datum behind, which owns nothing
+	d.type = VOID;
+	d.u.s = nullptr;
+	d.refCount = nullptr;
 }
 
 Datum& Datum::operator=(const Datum &d) {
-	if (this != &d && refCount != d.refCount) {
+	if (this != &d && (refCount != d.refCount || !refCount)) {
+		assert(d.refCount || !d.ownsData());
 		reset();
 		type = d.type;
 		u = d.u;
 		refCount = d.refCount;
-		*refCount += 1;
+		if (refCount)
+			*refCount += 1;
+	}
+	return *this;
+}
+
+Datum& Datum::operator=(Datum &&d) {
+	if (this != &d) {
+		reset();
+		type = d.type;
+		u = d.u;
+		refCount = d.refCount;
+
+		d.type = VOID;
+		d.u.s = nullptr;
+		d.refCount = nullptr;
 	}
 	return *this;
 }
@@ -616,15 +653,13 @@ Datum& Datum::operator=(const Datum &d) {
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = nullptr;
 }
 
 Datum::Datum(const Common::String &val) {
@@ -642,8 +677,7 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = nullptr;
 	}
 }
 
@@ -656,6 +690,8 @@ Datum::Datum(const CastMemberID &val) {
 
 Datum::Datum(const Common::Rect &rect) {
 	type = RECT;
+	refCount = new int;
+	*refCount = 1;
 	u.farr = new FArray;
 	u.farr->arr.push_back(Datum(rect.left));
 	u.farr->arr.push_back(Datum(rect.top));
@@ -663,9 +699,19 @@ Datum::Datum(const Common::Rect &rect) {
 	u.farr->arr.push_back(Datum(rect.bottom));
 }
 
-void Datum::reset() {
+void Datum::initRefCount() {
 	if (!refCount)
+		refCount = new int(1);
+}
+
+void Datum::reset() {
+	if (!refCount) {
+		// Nothing shares this datum's data. Objects keep their own
+		// reference count.
+		if (type != OBJECT)
+			freeData();
 		return;
+	}
 
 	*refCount -= 1;
 	// Coverity thinks that we always free memory, as it assumes
@@ -673,48 +719,73 @@ void Datum::reset() {
 	// Thus, DO NOT COMPILE, trick it and shut tons of false positives
 #ifndef __COVERITY__
 	if (*refCount <= 0) {
-		switch (type) {
-		case VARREF:
-		case GLOBALREF:
-		case LOCALREF:
-		case PROPREF:
-		case STRING:
-		case SYMBOL:
-			delete u.s;
-			break;
-		case ARRAY:
-		case POINT:
-		case RECT:
-			delete u.farr;
-			break;
-		case PARRAY:
-			delete u.parr;
-			break;
-		case OBJECT:
-			if (u.obj->getObjType() == kWindowObj) {
-				Window *window = static_cast<Window *>(u.obj);
-				g_director->_wm->removeWindow(window);
-				g_director->_wm->removeMarked();
-			} else {
-				delete u.obj;
-			}
-			break;
-		case CHUNKREF:
-			delete u.cref;
-			break;
-		case CASTREF:
-		case FIELDREF:
-			delete u.cast;
-			break;
-		default:
-			break;
-		}
+		freeData();
 		if (type != OBJECT) // object owns refCount
 			delete refCount;
 	}
 #endif
 }
 
+bool Datum::ownsData() const {
+	switch (type) {
+	case VARREF:
+	case GLOBALREF:
+	case LOCALREF:
+	case PROPREF:
+	case STRING:
+	case SYMBOL:
+	case ARRAY:
+	case POINT:
+	case RECT:
+	case PARRAY:
+	case CHUNKREF:
+	case CASTREF:
+	case FIELDREF:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void Datum::freeData() {
+	switch (type) {
+	case VARREF:
+	case GLOBALREF:
+	case LOCALREF:
+	case PROPREF:
+	case STRING:
+	case SYMBOL:
+		delete u.s;
+		break;
+	case ARRAY:
+	case POINT:
+	case RECT:
+		delete u.farr;
+		break;
+	case PARRAY:
+		delete u.parr;
+		break;
+	case OBJECT:
+		if (u.obj->getObjType() == kWindowObj) {
+			Window *window = static_cast<Window *>(u.obj);
+			g_director->_wm->removeWindow(window);
+			g_director->_wm->removeMarked();
+		} else {
+			delete u.obj;
+		}
+		break;
+	case CHUNKREF:
+		delete u.cref;
+		break;
+	case CASTREF:
+	case FIELDREF:
+		delete u.cast;
+		break;
+	default:
+		break;
+	}
+}
+
 Datum Datum::eval() const {
 	if (isRef()) {
 		return g_lingo->varFetch(*this);
@@ -1102,6 +1173,8 @@ void Lingo::runTests() {
 	Common::sort(fileList.begin(), fileList.end());
 
 	int counter = 1;
+	uint32 compileTime = 0, executeTime = 0;
+	uint executedInstructions = 0;
 
 	for (uint i = 0; i < fileList.size(); i++) {
 		Common::SeekableReadStream *const  stream = SearchMan.createReadStreamForMember(fileList[i]);
@@ -1114,13 +1187,20 @@ void Lingo::runTests() {
 
 			debug(">> Compiling file %s of size %d, id: %d", fileList[i].c_str(), size, counter);
 
+			uint32 startTime = g_system->getMillis();
 			mainArchive->addCode(Common::U32String(script, Common::kMacRoman), kTestScript, counter);
+			compileTime += g_system->getMillis() - startTime;
 
 			if (!debugChannelSet(-1, kDebugCompileOnly)) {
-				if (!_compiler->_hadError)
+				if (!_compiler->_hadError) {
+					uint startCounter = _globalCounter;
+					startTime = g_system->getMillis();
 					executeScript(kTestScript, CastMemberID(counter, 0));
-				else
+					executeTime += g_system->getMillis() - startTime;
+					executedInstructions += _globalCounter - startCounter;
+				} else {
 					debug(">> Skipping execution");
+				}
 			}
 
 			free(script);
@@ -1130,6 +1210,10 @@ void Lingo::runTests() {
 
 		inFile.close();
 	}
+
+	// Doubles as a benchmark for the compiler and the interpreter
+	debug(">> Compiled %d files in %u ms, executed %u instructions in %u ms", counter - 1, compileTime,
+		executedInstructions, executeTime);
 }
 
 void Lingo::executeImmediateScripts(Frame *frame) {
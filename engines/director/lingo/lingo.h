@@ -142,11 +142,13 @@ struct Datum {	/* interpreter stack type */
 		CastMemberID *cast;	/* CASTREF, FIELDREF */
 	} u;
 
-	int *refCount;
+	int *refCount; /* shared with all copies, nullptr for datums without data of their own */
 
 	Datum();
 	Datum(const Datum &d);
+	Datum(Datum &&d);
 	Datum& operator=(const Datum &d);
+	Datum& operator=(Datum &&d);
 	Datum(int val);
 	Datum(double val);
 	Datum(const Common::String &val);
@@ -155,6 +157,13 @@ struct Datum {	/* interpreter stack type */
 	Datum(const Common::Rect &rect);
 	void reset();
 
+	/**
+	 * Start counting the references to data which was attached by setting
+	 * the fields directly, e.g. a new string or array. Must be called when
+	 * the data is created, before the datum gets copied.
+	 */
+	void initRefCount();
+
 	~Datum() {
 		reset();
 	}
@@ -180,6 +189,11 @@ struct Datum {	/* interpreter stack type */
 	bool operator<(Datum &d) const;
 	bool operator>=(Datum &d) const;
 	bool operator<=(Datum &d) const;
+
+private:
+	/** Whether the datum points to data of its own. Objects keep their own reference count and are not included. */
+	bool ownsData() const;
+	void freeData();
 };
 
 struct ChunkReference {
@@ -25,6 +25,7 @@
 #include "engines/grim/debugger.h"
 #include "engines/grim/md5check.h"
 #include "engines/grim/grim.h"
+#include "engines/grim/set.h"
 
 namespace Grim {
 
@@ -37,6 +38,7 @@ Debugger::Debugger() :
 	registerCmd("set_renderer", WRAP_METHOD(Debugger, cmd_set_renderer));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("benchmark", WRAP_METHOD(Debugger, cmd_benchmark));
 }
 
 Debugger::~Debugger() {
@@ -126,4 +128,35 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_benchmark(int argc, const char **argv) {
+	Set *set = g_grim->getCurrSet();
+	if (!set) {
+		debugPrintf("No set is loaded\n");
+		return true;
+	}
+	int frames = argc > 1 ? atoi(argv[1]) : 100;
+	if (frames <= 0) {
+		debugPrintf("Usage: benchmark [<frames per setup>]\n");
+		return true;
+	}
+
+	// The setups of a set are the camera positions the game cuts between, so
+	// rendering from each of them in turn gives a repeatable camera path.
+	int prevSetup = set->getSetup();
+	uint32 totalTime = 0;
+	for (int i = 0; i < set->getNumSetups(); ++i) {
+		set->setSetup(i);
+		uint32 time = g_grim->benchmarkRender(frames);
+		totalTime += time;
+		debugPrintf("%s: %d frames in %d ms (%.2f fps)\n", set->getCurrSetup()->_name.c_str(),
+		            frames, time, time ? frames * 1000.0 / time : 0.0);
+	}
+	set->setSetup(prevSetup);
+
+	int totalFrames = frames * set->getNumSetups();
+	debugPrintf("Total: %d frames in %d ms (%.2f fps)\n", totalFrames, totalTime,
+	            totalTime ? totalFrames * 1000.0 / totalTime : 0.0);
+	return true;
+}
+
 }
@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/endian.h"
 #include "common/foreach.h"
 #include "engines/grim/debug.h"
@@ -89,6 +90,35 @@ EMIMeshFace::~EMIMeshFace() {
 	delete[] _indexes;
 }
 
+bool EMIMeshFace::isBlended() const {
+	if (_flags & (kAlphaBlend | kUnknownBlend))
+		return true;
+	if (_texID >= _parent->_numTextures)
+		return false;
+	if (_parent->_texFlags[_texID] & EMIModel::BlendAdditive)
+		return true;
+	// Selecting a texture with alpha enables blending as well.
+	const Material *mat = _parent->_mats[_texID];
+	return mat && mat->hasAlpha();
+}
+
+bool EMIMeshFace::canBatchWith(const EMIMeshFace &other) const {
+	return _texID == other._texID && _hasTexture == other._hasTexture && _flags == other._flags;
+}
+
+struct EMIMeshFaceStateLess {
+	bool operator()(const EMIMeshFace *a, const EMIMeshFace *b) const {
+		if (a->_texID != b->_texID)
+			return a->_texID < b->_texID;
+		if (a->_hasTexture != b->_hasTexture)
+			return a->_hasTexture < b->_hasTexture;
+		if (a->_flags != b->_flags)
+			return a->_flags < b->_flags;
+		// Keep the file order within a group.
+		return a < b;
+	}
+};
+
 void EMIModel::setTex(uint32 index) {
 	if (index < _numTextures && _mats[index]) {
 		_mats[index]->select();
@@ -187,6 +217,7 @@ void EMIModel::loadMesh(Common::SeekableReadStream *data) {
 		_faces[j].setParent(this);
 		_faces[j].loadFace(data);
 	}
+	sortFaces();
 
 	int hasBones = data->readUint32LE();
 
@@ -272,6 +303,45 @@ void EMIModel::prepareTextures() {
 	}
 }
 
+void EMIModel::sortFaces() {
+	// Whether a face is blended depends on its material, so this has to run
+	// after prepareTextures().
+	assert(_mats);
+
+	_fileOrderFaces.resize(_numFaces);
+	for (uint32 i = 0; i < _numFaces; i++)
+		_fileOrderFaces[i] = &_faces[i];
+
+	// Opaque faces are depth tested without blending, so their order does not
+	// matter and they can be grouped by state. Blended faces, including those
+	// with an alpha texture, keep their relative order and are drawn after all
+	// opaque ones.
+	_sortedFaces.clear();
+	_sortedFaces.reserve(_numFaces);
+	for (uint32 i = 0; i < _numFaces; i++) {
+		if (!_faces[i].isBlended())
+			_sortedFaces.push_back(&_faces[i]);
+	}
+	Common::sort(_sortedFaces.begin(), _sortedFaces.end(), EMIMeshFaceStateLess());
+	for (uint32 i = 0; i < _numFaces; i++) {
+		if (_faces[i].isBlended())
+			_sortedFaces.push_back(&_faces[i]);
+	}
+}
+
+void EMIModel::drawFaces(const Common::Array<const EMIMeshFace *> &faces) {
+	for (uint32 i = 0; i < faces.size();) {
+		const EMIMeshFace *first = faces[i];
+		uint32 count = 1;
+		while (i + count < faces.size() && first->canBatchWith(*faces[i + count]))
+			count++;
+
+		setTex(first->_texID);
+		g_driver->drawEMIModelFaces(this, &faces[i], count);
+		i += count;
+	}
+}
+
 void EMIModel::draw() {
 	prepareForRender();
 
@@ -303,10 +373,11 @@ void EMIModel::draw() {
 	}
 	// We will need to add a call to the skeleton, to get the modified vertices, but for now,
 	// I'll be happy with just static drawing
-	for (uint32 i = 0; i < _numFaces; i++) {
-		setTex(_faces[i]._texID);
-		g_driver->drawEMIModelFace(this, &_faces[i]);
-	}
+	// When the whole actor or mesh is translucent every face is blended, so the
+	// faces must then be drawn in file order.
+	bool translucent = actor->getEffectiveAlpha() < 1.0f || actor->hasLocalAlpha() ||
+	                   (_meshAlphaMode == Actor::AlphaReplace && _meshAlpha < 1.0f);
+	drawFaces(translucent ? _fileOrderFaces : _sortedFaces);
 
 	if (g_driver->supportsShaders() && actor->getLightMode() == Actor::LightNone) {
 		g_driver->enableLights();
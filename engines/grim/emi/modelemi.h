@@ -72,6 +72,8 @@ public:
 	~EMIMeshFace();
 	void loadFace(Common::SeekableReadStream *data);
 	void setParent(EMIModel *m) { _parent = m; }
+	bool isBlended() const;
+	bool canBatchWith(const EMIMeshFace &other) const;
 	void render();
 };
 
@@ -99,6 +101,11 @@ public:
 
 	uint32 _numFaces;
 	EMIMeshFace *_faces;
+	// The faces in file order and in draw order. In draw order the opaque faces
+	// come first, grouped by texture and flags, followed by the blended faces in
+	// file order.
+	Common::Array<const EMIMeshFace *> _fileOrderFaces;
+	Common::Array<const EMIMeshFace *> _sortedFaces;
 	uint32 _numTextures;
 	Common::String *_texNames;
 	uint32 *_texFlags;
@@ -136,7 +143,9 @@ public:
 	void loadMesh(Common::SeekableReadStream *data);
 	void prepareForRender();
 	void prepareTextures();
+	void sortFaces();
 	void draw();
+	void drawFaces(const Common::Array<const EMIMeshFace *> &faces);
 	void updateLighting(const Math::Matrix4 &modelToWorld);
 	void getBoundingBox(int *x1, int *y1, int *x2, int *y2) const;
 	Math::AABB calculateWorldBounds(const Math::Matrix4 &matrix) const;
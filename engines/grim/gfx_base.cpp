@@ -109,6 +109,11 @@ void GfxBase::drawMesh(const Mesh *mesh) {
 		mesh->_faces[i].draw(mesh);
 }
 
+void GfxBase::drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *const *faces, uint count) {
+	for (uint i = 0; i < count; i++)
+		drawEMIModelFace(model, faces[i]);
+}
+
 Math::Matrix4 GfxBase::makeLookMatrix(const Math::Vector3d& pos, const Math::Vector3d& interest, const Math::Vector3d& up) {
 	Math::Vector3d f = (interest - pos).getNormalized();
 	Math::Vector3d u = up.getNormalized();
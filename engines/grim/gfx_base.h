@@ -137,6 +137,11 @@ public:
 	virtual void translateViewpointFinish() = 0;
 
 	virtual void drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face) = 0;
+	/**
+	 * Draw a run of faces of the same model that share texture and flags.
+	 * The texture of the run has already been selected.
+	 */
+	virtual void drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *const *faces, uint count);
 	virtual void drawModelFace(const Mesh *mesh, const MeshFace *face) = 0;
 	virtual void drawSprite(const Sprite *sprite) = 0;
 	virtual void drawMesh(const Mesh *mesh);
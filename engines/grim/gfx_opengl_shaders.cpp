@@ -1003,24 +1003,32 @@ void GfxOpenGLS::updateEMIModel(const EMIModel* model) {
 }
 
 void GfxOpenGLS::drawEMIModelFace(const EMIModel* model, const EMIMeshFace* face) {
-	if (face->_flags & EMIMeshFace::kAlphaBlend ||
-	    face->_flags & EMIMeshFace::kUnknownBlend)
+	drawEMIModelFaces(model, &face, 1);
+}
+
+void GfxOpenGLS::drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *const *faces, uint count) {
+	// The faces of a run share texture and flags, so the shader only needs to
+	// be set up once for all of them.
+	const EMIMeshFace *first = faces[0];
+	if (first->_flags & EMIMeshFace::kAlphaBlend ||
+	    first->_flags & EMIMeshFace::kUnknownBlend)
 		glEnable(GL_BLEND);
 	const EMIModelUserData *mud = (const EMIModelUserData *)model->_userData;
 	OpenGL::ShaderGL *actorShader;
-	if ((face->_flags & EMIMeshFace::kNoLighting) ? false : _lightsEnabled)
+	if ((first->_flags & EMIMeshFace::kNoLighting) ? false : _lightsEnabled)
 		actorShader = mud->_shaderLights;
 	else
 		actorShader = mud->_shader;
 	actorShader->use();
-	bool textured = face->_hasTexture && !_currentShadowArray;
+	bool textured = first->_hasTexture && !_currentShadowArray;
 	actorShader->setUniform("textured", textured ? GL_TRUE : GL_FALSE);
 	actorShader->setUniform("useVertexAlpha", _selectedTexture->_hasAlpha);
 	actorShader->setUniform1f("meshAlpha", (model->_meshAlphaMode == Actor::AlphaReplace) ? model->_meshAlpha : 1.0f);
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, face->_indicesEBO);
-
-	glDrawElements(GL_TRIANGLES, 3 * face->_faceLength, GL_UNSIGNED_SHORT, nullptr);
+	for (uint i = 0; i < count; i++) {
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, faces[i]->_indicesEBO);
+		glDrawElements(GL_TRIANGLES, 3 * faces[i]->_faceLength, GL_UNSIGNED_SHORT, nullptr);
+	}
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
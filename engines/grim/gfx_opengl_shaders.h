@@ -89,6 +89,7 @@ public:
 	void translateViewpointFinish() override;
 
 	void drawEMIModelFace(const EMIModel* model, const EMIMeshFace* face) override;
+	void drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *const *faces, uint count) override;
 	void drawModelFace(const Mesh *mesh, const MeshFace *face) override;
 	void drawSprite(const Sprite *sprite) override;
 	void drawMesh(const Mesh *mesh) override;
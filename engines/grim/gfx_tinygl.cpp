@@ -619,16 +619,22 @@ void GfxTinyGL::set3DMode() {
 }
 
 void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face) {
-	uint16 *indices = (uint16 *)face->_indexes;
+	drawEMIModelFaces(model, &face, 1);
+}
+
+void GfxTinyGL::drawEMIModelFaces(const EMIModel *model, const EMIMeshFace *const *faces, uint count) {
+	// All faces of a run share texture and flags, so the state is set once and
+	// their triangles go into a single primitive batch.
+	const EMIMeshFace *first = faces[0];
 
 	tglEnable(TGL_DEPTH_TEST);
 	tglDisable(TGL_ALPHA_TEST);
 	tglDisable(TGL_LIGHTING);
-	if (!_currentShadowArray && face->_hasTexture)
+	if (!_currentShadowArray && first->_hasTexture)
 		tglEnable(TGL_TEXTURE_2D);
 	else
 		tglDisable(TGL_TEXTURE_2D);
-	if (face->_flags & EMIMeshFace::kAlphaBlend || face->_flags & EMIMeshFace::kUnknownBlend || _currentActor->hasLocalAlpha() || _alpha < 1.0f)
+	if (first->_flags & EMIMeshFace::kAlphaBlend || first->_flags & EMIMeshFace::kUnknownBlend || _currentActor->hasLocalAlpha() || _alpha < 1.0f)
 		tglEnable(TGL_BLEND);
 
 	tglBegin(TGL_TRIANGLES);
@@ -637,26 +643,31 @@ void GfxTinyGL::drawEMIModelFace(const EMIModel *model, const EMIMeshFace *face)
 		alpha *= model->_meshAlpha;
 	}
 	Math::Vector3d noLighting(1.f, 1.f, 1.f);
-	for (uint j = 0; j < face->_faceLength * 3; j++) {
-		uint16 index = indices[j];
+	for (uint f = 0; f < count; f++) {
+		const EMIMeshFace *face = faces[f];
+		uint16 *indices = (uint16 *)face->_indexes;
+
+		for (uint j = 0; j < face->_faceLength * 3; j++) {
+			uint16 index = indices[j];
 
-		if (!_currentShadowArray) {
-			if (face->_hasTexture) {
-				tglTexCoord2f(model->_texVerts[index].getX(), model->_texVerts[index].getY());
+			if (!_currentShadowArray) {
+				if (face->_hasTexture) {
+					tglTexCoord2f(model->_texVerts[index].getX(), model->_texVerts[index].getY());
+				}
+				Math::Vector3d lighting = (face->_flags & EMIMeshFace::kNoLighting) ? noLighting : model->_lighting[index];
+				byte r = (byte)(model->_colorMap[index].r * lighting.x());
+				byte g = (byte)(model->_colorMap[index].g * lighting.y());
+				byte b = (byte)(model->_colorMap[index].b * lighting.z());
+				byte a = (int)(alpha * (model->_meshAlphaMode == Actor::AlphaReplace ? model->_colorMap[index].a * _currentActor->getLocalAlpha(index) : 255.f));
+				tglColor4ub(r, g, b, a);
 			}
-			Math::Vector3d lighting = (face->_flags & EMIMeshFace::kNoLighting) ? noLighting : model->_lighting[index];
-			byte r = (byte)(model->_colorMap[index].r * lighting.x());
-			byte g = (byte)(model->_colorMap[index].g * lighting.y());
-			byte b = (byte)(model->_colorMap[index].b * lighting.z());
-			byte a = (int)(alpha * (model->_meshAlphaMode == Actor::AlphaReplace ? model->_colorMap[index].a * _currentActor->getLocalAlpha(index) : 255.f));
-			tglColor4ub(r, g, b, a);
-		}
 
-		Math::Vector3d normal = model->_normals[index];
-		Math::Vector3d vertex = model->_drawVertices[index];
+			Math::Vector3d normal = model->_normals[index];
+			Math::Vector3d vertex = model->_drawVertices[index];
 
-		tglNormal3fv(normal.getData());
-		tglVertex3fv(vertex.getData());
+			tglNormal3fv(normal.getData());
+			tglVertex3fv(vertex.getData());
+		}
 	}
 	tglEnd();
 
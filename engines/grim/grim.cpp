@@ -937,6 +937,16 @@ void GrimEngine::drawNormalMode() {
 	_currSet->drawBitmaps(ObjectState::OBJSTATE_OVERLAY);
 }
 
+uint32 GrimEngine::benchmarkRender(int frames) {
+	uint32 startTime = g_system->getMillis();
+	for (int i = 0; i < frames; ++i) {
+		g_driver->clearScreen();
+		drawNormalMode();
+		g_driver->flipBuffer();
+	}
+	return g_system->getMillis() - startTime;
+}
+
 void GrimEngine::doFlip() {
 	_frameCounter++;
 	if (!_doFlip) {
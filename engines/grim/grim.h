@@ -194,6 +194,11 @@ public:
 	TextObjectDefaults _sayLineDefaults, _printLineDefaults, _blastTextDefaults;
 
 	void debugLua(const Common::String &str);
+	/**
+	 * Render the current set from its current setup a number of times.
+	 * Returns the time taken, in milliseconds.
+	 */
+	uint32 benchmarkRender(int frames);
 
 protected:
 	void pauseEngineIntern(bool pause) override;
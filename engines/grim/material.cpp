@@ -309,6 +309,15 @@ int Material::getActiveTexture() const {
 	return _currImage;
 }
 
+bool Material::hasAlpha() const {
+	for (int i = 0; i < _data->_numImages; ++i) {
+		const Texture *t = _data->_textures[i];
+		if (t && t->_hasAlpha)
+			return true;
+	}
+	return false;
+}
+
 const Common::String &Material::getFilename() const {
 	return _data->_fname;
 }
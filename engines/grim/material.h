@@ -75,6 +75,8 @@ public:
 
 	int getNumTextures() const;
 	int getActiveTexture() const;
+	// Whether any image of the texture has an alpha channel
+	bool hasAlpha() const;
 
 	const Common::String &getFilename() const;
 	MaterialData *getData() const;
@@ -67,7 +67,7 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		_db(nullptr), _scriptEngine(nullptr),
 		_state(nullptr), _node(nullptr), _scene(nullptr), _archiveNode(nullptr),
 		_cursor(nullptr), _inventory(nullptr), _gfx(nullptr), _menu(nullptr),
-		_rnd(nullptr), _sound(nullptr), _ambient(nullptr),
+		_rnd(nullptr), _sound(nullptr), _ambient(nullptr), _faceCache(nullptr),
 		_inputSpacePressed(false), _inputEnterPressed(false),
 		_inputEscapePressed(false), _inputTildePressed(false),
 		_inputEscapePressedNotConsumed(false),
@@ -76,7 +76,8 @@ Myst3Engine::Myst3Engine(OSystem *syst, const Myst3GameDescription *version) :
 		_shakeEffect(nullptr), _rotationEffect(nullptr),
 		_backgroundSoundScriptLastRoomId(0),
 		_backgroundSoundScriptLastAgeId(0),
-		_transition(nullptr), _frameLimiter(nullptr), _inventoryManualHide(false) {
+		_transition(nullptr), _frameLimiter(nullptr), _frameStartTime(0),
+		_frameTimeslot(0), _inventoryManualHide(false) {
 
 	// Add subdirectories to the search path to allow running from a full HDD install
 	const Common::FSNode gameDataDir(ConfMan.get("path"));
@@ -120,6 +121,7 @@ Myst3Engine::~Myst3Engine() {
 	delete _rnd;
 	delete _sound;
 	delete _ambient;
+	delete _faceCache;
 	delete _frameLimiter;
 	delete _gfx;
 }
@@ -148,7 +150,11 @@ Common::Error Myst3Engine::run() {
 	_gfx->init();
 	_gfx->clear();
 
-	_frameLimiter = new Graphics::FrameLimiter(_system, ConfMan.getInt("engine_speed"));
+	int engineSpeed = ConfMan.getInt("engine_speed");
+	_frameLimiter = new Graphics::FrameLimiter(_system, engineSpeed);
+	// With an unlimited engine speed, still keep the frames short enough for 60 fps
+	_frameTimeslot = 1000 / CLIP(engineSpeed > 0 ? engineSpeed : 60, 1, 100);
+	_frameStartTime = _system->getMillis();
 	_sound = new Sound(this);
 	_ambient = new Ambient(this);
 	_rnd = new Common::RandomSource("sprint");
@@ -163,6 +169,7 @@ Common::Error Myst3Engine::run() {
 		_menu = new PagingMenu(this);
 	}
 	_archiveNode = new Archive();
+	_faceCache = new FaceCache(this);
 
 	_system->showMouse(false);
 
@@ -210,6 +217,7 @@ Common::Error Myst3Engine::run() {
 	}
 
 	unloadNode();
+	_faceCache->clear();
 
 	_archiveNode->close();
 	_gfx->freeFont();
@@ -749,13 +757,22 @@ void Myst3Engine::drawFrame(bool noSwap) {
 	_gfx->flipBuffer();
 
 	if (!noSwap) {
+		// Use the idle time to get the next nodes ready
+		_faceCache->decodeNext(getFrameIdleTime());
+
 		_frameLimiter->delayBeforeSwap();
 		_system->updateScreen();
 		_state->updateFrameCounters();
 		_frameLimiter->startFrame();
+		_frameStartTime = _system->getMillis();
 	}
 }
 
+uint Myst3Engine::getFrameIdleTime() const {
+	uint32 elapsed = _system->getMillis() - _frameStartTime;
+	return elapsed < _frameTimeslot ? _frameTimeslot - elapsed : 0;
+}
+
 bool Myst3Engine::isInventoryVisible() {
 	if (_state->getViewType() == kMenu)
 		return false;
@@ -867,6 +884,30 @@ void Myst3Engine::loadNode(uint16 nodeID, uint32 roomID, uint32 ageID) {
 	// Releeshan to the player when he is trapped between both shields.
 	if (nodeID == 9 && roomID == kRoomNarayan)
 		_state->setVar(39, 0);
+
+	prefetchNodeDestinations();
+}
+
+void Myst3Engine::prefetchNodeDestinations() {
+	_faceCache->clearQueue();
+
+	if (_state->getViewType() != kCube)
+		return;
+
+	NodePtr nodeData = _db->getNodeData(_state->getLocationNode(), _state->getLocationRoom(), _state->getLocationAge());
+	if (!nodeData)
+		return;
+
+	// The hotspots are where the player usually leaves the node from
+	Common::Array<uint16> destinations;
+	for (uint i = 0; i < nodeData->hotspots.size(); i++) {
+		_scriptEngine->findNodeDestinations(nodeData->hotspots[i].script, destinations);
+	}
+
+	for (uint i = 0; i < destinations.size(); i++) {
+		if (destinations[i] != _state->getLocationNode())
+			_faceCache->prefetchNode(destinations[i]);
+	}
 }
 
 void Myst3Engine::unloadNode() {
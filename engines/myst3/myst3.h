@@ -73,6 +73,7 @@ class SunSpot;
 class Renderer;
 class Menu;
 class Node;
+class FaceCache;
 class Sound;
 class Ambient;
 class ScriptedMovie;
@@ -102,6 +103,7 @@ public:
 	Database *_db;
 	Sound *_sound;
 	Ambient *_ambient;
+	FaceCache *_faceCache;
 
 	Common::RandomSource *_rnd;
 
@@ -152,6 +154,7 @@ public:
 	void runScriptsFromNode(uint16 nodeID, uint32 roomID = 0, uint32 ageID = 0);
 	void runBackgroundSoundScriptsFromNode(uint16 nodeID, uint32 roomID = 0, uint32 ageID = 0);
 	void runAmbientScripts(uint32 node);
+	void prefetchNodeDestinations();
 
 	void loadMovie(uint16 id, uint16 condition, bool resetCond, bool loop);
 	void playMovieGoToNode(uint16 movie, uint16 node);
@@ -174,6 +177,8 @@ public:
 	void getMovieLookAt(uint16 id, bool start, float &pitch, float &heading);
 
 	void drawFrame(bool noSwap = false);
+	/** Time left before the end of the timeslot of the current frame, in ms */
+	uint getFrameIdleTime() const;
 
 	void processInput(bool interactive);
 	void processEventForKeyboardState(const Common::Event &event);
@@ -212,6 +217,8 @@ private:
 	RotationEffect *_rotationEffect;
 
 	Graphics::FrameLimiter *_frameLimiter;
+	uint32 _frameStartTime;
+	uint _frameTimeslot; // Frame duration aimed for, in ms
 	Transition *_transition;
 
 	bool _inputSpacePressed;
@@ -29,19 +29,25 @@
 #include "common/config-manager.h"
 #include "common/debug.h"
 #include "common/rect.h"
+#include "common/system.h"
 
 namespace Myst3 {
 
 void Face::setTextureFromJPEG(const ResourceDescription *jpegDesc) {
-	_bitmap = Myst3Engine::decodeJpeg(jpegDesc);
+	setTextureFromBitmap(Myst3Engine::decodeJpeg(jpegDesc));
+}
+
+void Face::setTextureFromBitmap(Graphics::Surface *bitmap) {
+	_bitmap = bitmap;
 	if (_is3D) {
 		_texture = _vm->_gfx->createTexture3D(_bitmap);
 	} else {
 		_texture = _vm->_gfx->createTexture2D(_bitmap);
 	}
 
-	// Set the whole texture as dirty
-	addTextureDirtyRect(Common::Rect(_bitmap->w, _bitmap->h));
+	// The texture is created with the bitmap contents,
+	// it only needs to be updated once something draws over it
+	_textureDirty = false;
 }
 
 Face::Face(Myst3Engine *vm, bool is3D) :
@@ -89,6 +95,114 @@ Face::~Face() {
 	}
 }
 
+FaceCache::FaceCache(Myst3Engine *vm) :
+		_vm(vm),
+		_decodeTime(0) {
+}
+
+FaceCache::~FaceCache() {
+	clear();
+}
+
+void FaceCache::freeEntry(Entry &entry) {
+	if (entry.bitmap) {
+		entry.bitmap->free();
+		delete entry.bitmap;
+		entry.bitmap = nullptr;
+	}
+}
+
+void FaceCache::clear() {
+	for (EntryList::iterator it = _faces.begin(); it != _faces.end(); it++) {
+		freeEntry(*it);
+	}
+	_faces.clear();
+	_queue.clear();
+}
+
+void FaceCache::clearQueue() {
+	_queue.clear();
+}
+
+Common::String FaceCache::getCurrentRoomName() const {
+	return _vm->_db->getRoomName(_vm->_state->getLocationRoom(), _vm->_state->getLocationAge());
+}
+
+bool FaceCache::isCached(const Common::String &room, uint16 nodeId, uint16 faceId) const {
+	for (EntryList::const_iterator it = _faces.begin(); it != _faces.end(); it++) {
+		if (it->node == nodeId && it->face == faceId && it->room == room)
+			return true;
+	}
+
+	return false;
+}
+
+void FaceCache::prefetchNode(uint16 nodeId) {
+	Common::String room = getCurrentRoomName();
+
+	for (uint16 faceId = 1; faceId <= 6; faceId++) {
+		// Don't queue more than the cache can hold,
+		// the faces decoded first would be evicted by the last ones
+		if (_queue.size() >= kMaxFaces)
+			return;
+
+		if (isCached(room, nodeId, faceId))
+			continue;
+
+		Entry entry;
+		entry.room = room;
+		entry.node = nodeId;
+		entry.face = faceId;
+		entry.bitmap = nullptr;
+		_queue.push_back(entry);
+	}
+}
+
+bool FaceCache::decodeNext(uint idleTime) {
+	// A face is decoded in one go, don't start one which would make the frame late
+	if (_decodeTime >= idleTime)
+		return false;
+
+	while (!_queue.empty()) {
+		Entry entry = _queue.front();
+		_queue.pop_front();
+
+		// Nodes using frames instead of cubes have no cube faces
+		ResourceDescription jpegDesc = _vm->getFileDescription(entry.room, entry.node, entry.face, Archive::kCubeFace);
+		if (!jpegDesc.isValid())
+			continue;
+
+		if (_faces.size() >= kMaxFaces) {
+			freeEntry(_faces.back());
+			_faces.pop_back();
+		}
+
+		debugC(kDebugNode, "Prefetching face %d of node %s %d", entry.face, entry.room.c_str(), entry.node);
+
+		uint32 startTime = g_system->getMillis();
+		entry.bitmap = Myst3Engine::decodeJpeg(&jpegDesc);
+		_decodeTime = g_system->getMillis() - startTime;
+		_faces.push_front(entry);
+		return true;
+	}
+
+	return false;
+}
+
+Graphics::Surface *FaceCache::takeFace(uint16 nodeId, uint16 faceId) {
+	Common::String room = getCurrentRoomName();
+
+	for (EntryList::iterator it = _faces.begin(); it != _faces.end(); it++) {
+		if (it->node == nodeId && it->face == faceId && it->room == room) {
+			Graphics::Surface *bitmap = it->bitmap;
+			_faces.erase(it);
+			return bitmap;
+		}
+	}
+
+	return nullptr;
+}
+
 Node::Node(Myst3Engine *vm, uint16 id) :
 		_vm(vm),
 		_id(id),
@@ -26,6 +26,7 @@
 #include "engines/myst3/gfx.h"
 
 #include "common/array.h"
+#include "common/list.h"
 #include "common/rect.h"
 
 #include "graphics/surface.h"
@@ -47,6 +48,7 @@ public:
 	~Face();
 
 	void setTextureFromJPEG(const ResourceDescription *jpegDesc);
+	void setTextureFromBitmap(Graphics::Surface *bitmap);
 
 	void addTextureDirtyRect(const Common::Rect &rect);
 	bool isTextureDirty() { return _textureDirty; }
@@ -61,6 +63,61 @@ private:
 	bool _is3D;
 };
 
+/**
+ * Decoded cube faces of the nodes the player is likely to go to next
+ *
+ * The faces are decoded one at a time with the time left at the end of
+ * the frames, so that loading these nodes does not need to decode them.
+ */
+class FaceCache {
+public:
+	FaceCache(Myst3Engine *vm);
+	~FaceCache();
+
+	/** Queue the cube faces of a node of the current room for decoding */
+	void prefetchNode(uint16 nodeId);
+
+	/** Forget about the faces queued for decoding */
+	void clearQueue();
+
+	/**
+	 * Decode the next queued face if it is expected to take less than the given time, in ms
+	 *
+	 * Returns false when no face was decoded.
+	 */
+	bool decodeNext(uint idleTime);
+
+	/**
+	 * Remove a face of a node of the current room from the cache
+	 *
+	 * The caller owns the returned bitmap. Returns nullptr if the face is not cached.
+	 */
+	Graphics::Surface *takeFace(uint16 nodeId, uint16 faceId);
+
+	void clear();
+
+private:
+	static const uint kMaxFaces = 18;
+
+	struct Entry {
+		Common::String room;
+		uint16 node;
+		uint16 face;
+		Graphics::Surface *bitmap;
+	};
+
+	typedef Common::List<Entry> EntryList;
+
+	Myst3Engine *_vm;
+	EntryList _faces; // Most recently decoded first
+	EntryList _queue;
+	uint _decodeTime; // Duration of the last face decoding, in ms
+
+	Common::String getCurrentRoomName() const;
+	bool isCached(const Common::String &room, uint16 nodeId, uint16 faceId) const;
+	static void freeEntry(Entry &entry);
+};
+
 class SpotItemFace {
 public:
 	SpotItemFace(Face *face, uint16 posX, uint16 posY);
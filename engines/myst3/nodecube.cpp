@@ -32,12 +32,20 @@ NodeCube::NodeCube(Myst3Engine *vm, uint16 id) :
 	_is3D = true;
 
 	for (int i = 0; i < 6; i++) {
+		_faces[i] = new Face(_vm, true);
+
+		// The face may have been decoded ahead of time
+		Graphics::Surface *bitmap = _vm->_faceCache->takeFace(id, i + 1);
+		if (bitmap) {
+			_faces[i]->setTextureFromBitmap(bitmap);
+			continue;
+		}
+
 		ResourceDescription jpegDesc = _vm->getFileDescription("", id, i + 1, Archive::kCubeFace);
 
 		if (!jpegDesc.isValid())
 			error("Face %d does not exist", id);
 
-		_faces[i] = new Face(_vm, true);
 		_faces[i]->setTextureFromJPEG(&jpegDesc);
 	}
 }
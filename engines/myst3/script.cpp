@@ -315,6 +315,31 @@ bool Script::run(const Common::Array<Opcode> *script) {
 	return c.result;
 }
 
+void Script::findNodeDestinations(const Common::Array<Opcode> &script, Common::Array<uint16> &nodes) {
+	for (uint i = 0; i < script.size(); i++) {
+		const Opcode &cmd = script[i];
+		CommandProc proc = findCommand(cmd.op).proc;
+
+		int16 destinations[2] = { 0, 0 };
+		if (proc == &Script::goToNodeTransition
+				|| proc == &Script::goToNodeTrans1
+				|| proc == &Script::goToNodeTrans2
+				|| proc == &Script::zipToNode
+				|| proc == &Script::changeNode) {
+			destinations[0] = cmd.args[0];
+		} else if (proc == &Script::chooseNextNode) {
+			destinations[0] = cmd.args[1];
+			destinations[1] = cmd.args[2];
+		}
+
+		// Negative values are variables, their value is only known when the script runs
+		for (uint j = 0; j < ARRAYSIZE(destinations); j++) {
+			if (destinations[j] > 0 && Common::find(nodes.begin(), nodes.end(), destinations[j]) == nodes.end())
+				nodes.push_back(destinations[j]);
+		}
+	}
+}
+
 const Script::Command &Script::findCommand(uint16 op) {
 	for (uint16 i = 0; i < _commands.size(); i++)
 		if (_commands[i].op == op)
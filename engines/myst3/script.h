@@ -42,6 +42,11 @@ public:
 
 	const Common::String describeOpcode(const Opcode &opcode);
 
+	/**
+	 * Appends the nodes of the current room the script can take the player to
+	 */
+	void findNodeDestinations(const Common::Array<Opcode> &script, Common::Array<uint16> &nodes);
+
 private:
 	struct Context {
 		bool endScript;
@@ -162,6 +162,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
 	registerCmd("gc_normalize",		WRAP_METHOD(Console, cmdGCNormalize));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	// Music/SFX
 	registerCmd("songlib",			WRAP_METHOD(Console, cmdSongLib));
 	registerCmd("songinfo",			WRAP_METHOD(Console, cmdSongInfo));
@@ -225,6 +226,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("bpe",				WRAP_METHOD(Console, cmdBreakpointFunction));		// alias
 	// VM
 	registerCmd("script_steps",		WRAP_METHOD(Console, cmdScriptSteps));
+	registerCmd("script_predecode",	WRAP_METHOD(Console, cmdScriptPredecode));
 	registerCmd("script_objects",   WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("scro",             WRAP_METHOD(Console, cmdScriptObjects));
 	registerCmd("script_strings",   WRAP_METHOD(Console, cmdScriptStrings));
@@ -388,6 +390,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
 	debugPrintf(" gc_normalize - Prints the \"normal\" address of a given address\n");
+	debugPrintf(" gc_stats - Shows garbage collector pause times\n");
 	debugPrintf("\n");
 	debugPrintf("Music/SFX:\n");
 	debugPrintf(" songlib - Shows the song library\n");
@@ -432,7 +435,8 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf(" bp_function / bpe - Sets a breakpoint on the execution of the specified exported function\n");
 	debugPrintf("\n");
 	debugPrintf("VM:\n");
-	debugPrintf(" script_steps - Shows the number of executed SCI operations\n");
+	debugPrintf(" script_steps - Shows the number of executed SCI operations and selector cache hits\n");
+	debugPrintf(" script_predecode - Enables or disables caching of decoded SCI instructions\n");
 	debugPrintf(" script_objects / scro - Shows all objects inside a specified script\n");
 	debugPrintf(" script_strings / scrs - Shows all strings inside a specified script\n");
 	debugPrintf(" script_said - Shows all said - strings inside a specified script\n");
@@ -2735,6 +2739,26 @@ bool Console::cmdGCInvoke(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	GCStats &stats = _engine->_gamestate->gcStats;
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		memset(&stats, 0, sizeof(stats));
+		debugPrintf("Garbage collector statistics reset\n");
+		return true;
+	}
+
+	debugPrintf("Garbage collections: %u, %u objects freed\n", stats.runs, stats.totalFreed);
+	if (stats.runs) {
+		debugPrintf("Pause times: last %u ms, average %u ms, max %u ms, total %u ms\n",
+			stats.lastPause, stats.totalPause / stats.runs, stats.maxPause, stats.totalPause);
+		debugPrintf("Last collection: %u reachable addresses, %u objects freed\n",
+			stats.lastReachable, stats.lastFreed);
+	}
+	debugPrintf("Use \"%s reset\" to reset these counters\n", argv[0]);
+	return true;
+}
+
 bool Console::cmdGCObjects(int argc, const char **argv) {
 	AddrSet *use_map = findAllActiveReferences(_engine->_gamestate);
 
@@ -3266,7 +3290,38 @@ bool Console::cmdViewAccumulatorObject(int argc, const char **argv) {
 }
 
 bool Console::cmdScriptSteps(int argc, const char **argv) {
-	debugPrintf("Number of executed SCI operations: %d\n", _engine->_gamestate->scriptStepCounter);
+	SegManager::SelectorCacheStats &stats = _engine->_gamestate->_segMan->getSelectorCacheStats();
+
+	if (argc == 2 && !scumm_stricmp(argv[1], "reset")) {
+		_engine->_gamestate->scriptStepCounter = 0;
+		_engine->_gamestate->scriptStepStartTime = g_system->getMillis();
+		_engine->_gamestate->_segMan->resetSelectorCacheStats();
+		debugPrintf("Counters reset\n");
+		return true;
+	}
+
+	const uint32 scriptTime = g_system->getMillis() - _engine->_gamestate->scriptStepStartTime;
+	debugPrintf("Number of executed SCI operations: %d in %u ms (%u per second)\n", _engine->_gamestate->scriptStepCounter,
+		scriptTime, scriptTime ? (uint)((uint64)_engine->_gamestate->scriptStepCounter * 1000 / scriptTime) : 0);
+	debugPrintf("Instruction predecoding: %s\n", _engine->_gamestate->scriptPredecode ? "on" : "off");
+
+	const uint32 lookups = stats.hits + stats.misses;
+	debugPrintf("Selector lookups: %u, cache hits: %u (%u%%), misses: %u, invalidations: %u\n",
+		lookups, stats.hits, lookups ? (uint)((uint64)stats.hits * 100 / lookups) : 0,
+		stats.misses, stats.invalidations);
+	return true;
+}
+
+bool Console::cmdScriptPredecode(int argc, const char **argv) {
+	if (argc != 2) {
+		debugPrintf("Enables or disables caching of decoded SCI instructions.\n");
+		debugPrintf("Usage: %s on|off\n", argv[0]);
+		debugPrintf("Instruction predecoding is currently %s\n", _engine->_gamestate->scriptPredecode ? "on" : "off");
+		return true;
+	}
+
+	_engine->_gamestate->scriptPredecode = !scumm_stricmp(argv[1], "on");
+	debugPrintf("Instruction predecoding is now %s\n", _engine->_gamestate->scriptPredecode ? "on" : "off");
 	return true;
 }
 
@@ -21,6 +21,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -67,20 +68,16 @@ void WorklistManager::pushArray(const Common::Array<reg_t> &tmp) {
 		push(*it);
 }
 
-static AddrSet *normalizeAddresses(SegManager *segMan, const AddrSet &nonnormal_map) {
-	AddrSet *normal_map = new AddrSet();
-
+static void normalizeAddresses(SegManager *segMan, const AddrSet &nonnormal_map, AddrSet &normal_map) {
 	for (AddrSet::const_iterator i = nonnormal_map.begin(); i != nonnormal_map.end(); ++i) {
 		reg_t reg = i->_key;
 		SegmentObj *mobj = segMan->getSegmentObj(reg.getSegment());
 
 		if (mobj) {
 			reg = mobj->findCanonicAddress(segMan, reg);
-			normal_map->setVal(reg, true);
+			normal_map.setVal(reg, true);
 		}
 	}
-
-	return normal_map;
 }
 
 static void processWorkList(SegManager *segMan, WorklistManager &wm, const Common::Array<SegmentObj *> &heap) {
@@ -98,11 +95,9 @@ static void processWorkList(SegManager *segMan, WorklistManager &wm, const Commo
 	}
 }
 
-AddrSet *findAllActiveReferences(EngineState *s) {
+static void findAllActiveReferences(EngineState *s, WorklistManager &wm, AddrSet &activeRefs) {
 	assert(!s->_executionStack.empty());
 
-	WorklistManager wm;
-
 	// Initialize registers
 	wm.push(s->r_acc);
 	wm.push(s->r_prev);
@@ -175,7 +170,14 @@ AddrSet *findAllActiveReferences(EngineState *s) {
 	if (g_sci->_gfxPorts)
 		g_sci->_gfxPorts->processEngineHunkList(wm);
 
-	return normalizeAddresses(s->_segMan, wm._map);
+	normalizeAddresses(s->_segMan, wm._map, activeRefs);
+}
+
+AddrSet *findAllActiveReferences(EngineState *s) {
+	WorklistManager wm;
+	AddrSet *activeRefs = new AddrSet();
+	findAllActiveReferences(s, wm, *activeRefs);
+	return activeRefs;
 }
 
 void run_gc(EngineState *s) {
@@ -190,8 +192,21 @@ void run_gc(EngineState *s) {
 	memset(segcount, 0, sizeof(segcount));
 #endif
 
+	const uint32 startTime = g_system->getMillis();
+	uint32 freed = 0;
+
+	if (!s->gcContext)
+		s->gcContext = new GCContext();
+
+	// Reuse the buffers of the previous run, without shrinking them. The
+	// worklist itself is always left empty by processWorkList().
+	WorklistManager &wm = s->gcContext->_wm;
+	AddrSet &activeRefs = s->gcContext->_activeRefs;
+	wm._map.clear();
+	activeRefs.clear();
+
 	// Compute the set of all segments references currently in use.
-	AddrSet *activeRefs = findAllActiveReferences(s);
+	findAllActiveReferences(s, wm, activeRefs);
 
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
@@ -210,9 +225,10 @@ void run_gc(EngineState *s) {
 			const Common::Array<reg_t> tmp = mobj->listAllDeallocatable(seg);
 			for (Common::Array<reg_t>::const_iterator it = tmp.begin(); it != tmp.end(); ++it) {
 				const reg_t addr = *it;
-				if (!activeRefs->contains(addr)) {
+				if (!activeRefs.contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					freed++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -223,7 +239,16 @@ void run_gc(EngineState *s) {
 		}
 	}
 
-	delete activeRefs;
+	const uint32 pause = g_system->getMillis() - startTime;
+	GCStats &stats = s->gcStats;
+	stats.runs++;
+	stats.lastPause = pause;
+	stats.maxPause = MAX(stats.maxPause, pause);
+	stats.totalPause += pause;
+	stats.lastReachable = activeRefs.size();
+	stats.lastFreed = freed;
+	stats.totalFreed += freed;
+	debugC(kDebugLevelGC, "[GC] Done in %u ms, %u reachable, %u freed", pause, stats.lastReachable, freed);
 
 #ifdef GC_DEBUG_CODE
 	// Output debug summary of garbage collection
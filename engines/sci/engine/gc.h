@@ -62,6 +62,17 @@ struct WorklistManager {
 	void pushArray(const Common::Array<reg_t> &tmp);
 };
 
+/**
+ * The worklist and reference sets used by run_gc(). They are kept in the
+ * EngineState between runs, so that their storage, which grows to the size of
+ * the game's live object graph, does not have to be reallocated and rehashed
+ * by every collection.
+ */
+struct GCContext {
+	WorklistManager _wm;
+	AddrSet _activeRefs;
+};
+
 
 } // End of namespace Sci
 
@@ -198,6 +198,34 @@ int Object::locateVarSelector(SegManager *segMan, Selector slc) const {
 	return -1; // Failed
 }
 
+const Object::SelectorCacheEntry *Object::getCachedSelector(Selector selectorId, uint32 generation) const {
+	if (_selectorCacheGeneration != generation ||
+		_selectorCacheSuper != getSuperClassSelector() ||
+		_selectorCacheInfo != getInfoSelector())
+		return nullptr;
+
+	const SelectorCacheEntry &entry = _selectorCache[selectorId & (kSelectorCacheSize - 1)];
+	return entry.selector == selectorId ? &entry : nullptr;
+}
+
+void Object::cacheSelector(Selector selectorId, uint32 generation, SelectorType type, int varIndex, reg_t funcPos) const {
+	if (_selectorCacheGeneration != generation ||
+		_selectorCacheSuper != getSuperClassSelector() ||
+		_selectorCacheInfo != getInfoSelector()) {
+		for (uint i = 0; i < kSelectorCacheSize; ++i)
+			_selectorCache[i].selector = -1;
+		_selectorCacheGeneration = generation;
+		_selectorCacheSuper = getSuperClassSelector();
+		_selectorCacheInfo = getInfoSelector();
+	}
+
+	SelectorCacheEntry &entry = _selectorCache[selectorId & (kSelectorCacheSize - 1)];
+	entry.selector = selectorId;
+	entry.type = type;
+	entry.varIndex = varIndex;
+	entry.funcPos = funcPos;
+}
+
 bool Object::relocateSci0Sci21(SegmentId segment, int location, uint32 heapOffset) {
 	return relocateBlock(_variables, getPos().getOffset(), segment, location, heapOffset);
 }
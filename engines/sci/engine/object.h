@@ -27,6 +27,7 @@
 #include "common/textconsole.h"
 
 #include "sci/sci.h"			// for the SCI versions
+#include "sci/engine/vm.h"		// for SelectorType
 #include "sci/engine/vm_types.h"	// for reg_t
 #include "sci/util.h"
 
@@ -73,7 +74,10 @@ public:
 		_offset(getSciVersion() < SCI_VERSION_1_1 ? 0 : 5),
 		_isFreed(false),
 		_methodCount(0),
-	    _pos(NULL_REG)
+	    _pos(NULL_REG),
+		_selectorCacheSuper(NULL_REG),
+		_selectorCacheInfo(NULL_REG),
+		_selectorCacheGeneration(0)
 #ifdef ENABLE_SCI32
 		,
 		_infoSelectorSci3(NULL_REG),
@@ -92,6 +96,7 @@ public:
 		_offset = other._offset;
 		_pos = other._pos;
 		_baseVars = other._baseVars;
+		invalidateSelectorCache();
 
 #ifdef ENABLE_SCI32
 		if (getSciVersion() == SCI_VERSION_3) {
@@ -106,6 +111,31 @@ public:
 		return *this;
 	}
 
+	struct SelectorCacheEntry {
+		Selector selector;
+		SelectorType type;
+		int varIndex;
+		reg_t funcPos;
+	};
+
+	/**
+	 * Returns the cached result of a previous selector lookup on this object,
+	 * or nullptr if there is none which is still valid for the given
+	 * selector cache generation.
+	 */
+	const SelectorCacheEntry *getCachedSelector(Selector selectorId, uint32 generation) const;
+
+	/**
+	 * Remembers the result of a selector lookup on this object.
+	 */
+	void cacheSelector(Selector selectorId, uint32 generation, SelectorType type, int varIndex, reg_t funcPos) const;
+
+	/**
+	 * Drops all cached selector lookups for this object. Called whenever the
+	 * object's class information changes.
+	 */
+	void invalidateSelectorCache() const { _selectorCacheGeneration = 0; }
+
 	reg_t getSpeciesSelector() const {
 #ifdef ENABLE_SCI32
 		if (getSciVersion() == SCI_VERSION_3)
@@ -122,6 +152,7 @@ public:
 		else
 #endif
 			_variables[_offset] = value;
+		invalidateSelectorCache();
 	}
 
 	reg_t getSuperClassSelector() const {
@@ -140,6 +171,7 @@ public:
 		else
 #endif
 			_variables[_offset + 1] = value;
+		invalidateSelectorCache();
 	}
 
 	reg_t getInfoSelector() const {
@@ -158,6 +190,7 @@ public:
 		else
 #endif
 			_variables[_offset + 2] = info;
+		invalidateSelectorCache();
 	}
 
 #ifdef ENABLE_SCI32
@@ -368,6 +401,19 @@ private:
 	uint16 _offset;
 
 	reg_t _pos; /**< Object offset within its script; for clones, this is their base */
+
+	/**
+	 * A small direct-mapped cache of recent lookupSelector() results for
+	 * this object, indexed by the low bits of the selector. The cache is
+	 * only trusted while the superclass, -info- and the segment manager's
+	 * selector cache generation match the values recorded when it was
+	 * filled.
+	 */
+	enum { kSelectorCacheSize = 8 };
+	mutable SelectorCacheEntry _selectorCache[kSelectorCacheSize];
+	mutable reg_t _selectorCacheSuper;
+	mutable reg_t _selectorCacheInfo;
+	mutable uint32 _selectorCacheGeneration;
 #ifdef ENABLE_SCI32
 	reg_t _superClassPosSci3; /**< reg_t pointing to superclass for SCI3 */
 	reg_t _speciesSelectorSci3;	/**< reg_t containing species "selector" for SCI3 */
@@ -68,6 +68,8 @@ void Script::freeScript(const bool keepLocalsSegment) {
 	_markedAsDeleted = false;
 	_objects.clear();
 
+	invalidateDecodedInstructions();
+
 	_offsetLookupArray.clear();
 	_offsetLookupObjectCount = 0;
 	_offsetLookupStringCount = 0;
@@ -79,6 +81,39 @@ enum {
 	kSci11ExportTableOffset = 8
 };
 
+void Script::invalidateDecodedInstructions() {
+	_decodedInstructionIndex.clear();
+	_decodedInstructions.clear();
+}
+
+void Script::getDecodedInstruction(uint32 offset, DecodedInstruction &instr) {
+	// Code only lives in the script block, never in the SCI1.1 - SCI2.1 heap
+	const uint32 codeSize = _script.size();
+
+	if (offset < codeSize && g_sci->getEngineState()->scriptPredecode) {
+		if (_decodedInstructionIndex.empty())
+			_decodedInstructionIndex.resize(codeSize);
+
+		const uint16 index = _decodedInstructionIndex[offset];
+		if (index) {
+			instr = _decodedInstructions[index - 1];
+			return;
+		}
+
+		instr.size = readPMachineInstruction(getBuf(offset), instr.extOpcode, instr.opparams);
+
+		// The index is 16 bits wide, so very large SCI3 scripts may run out
+		// of slots; any further instructions are just decoded every time
+		if (_decodedInstructions.size() < 0xFFFF) {
+			_decodedInstructions.push_back(instr);
+			_decodedInstructionIndex[offset] = _decodedInstructions.size();
+		}
+		return;
+	}
+
+	instr.size = readPMachineInstruction(getBuf(offset), instr.extOpcode, instr.opparams);
+}
+
 void Script::load(int script_nr, ResourceManager *resMan, ScriptPatcher *scriptPatcher, bool applyScriptPatches) {
 	freeScript();
 
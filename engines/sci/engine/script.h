@@ -68,6 +68,16 @@ struct offsetLookupArrayEntry {
 
 typedef Common::Array<offsetLookupArrayEntry> offsetLookupArrayType;
 
+/**
+ * A PMachine instruction as decoded by readPMachineInstruction(), kept around
+ * so that run_vm() does not have to decode it again every time it is executed.
+ */
+struct DecodedInstruction {
+	int16 opparams[4];
+	uint16 size;    ///< Size of the instruction in bytes
+	byte extOpcode; ///< Opcode, including the operand size bit
+};
+
 class Script : public SegmentObj {
 private:
 	int _nr; /**< Script number */
@@ -101,6 +111,14 @@ private:
 	uint16 _offsetLookupStringCount;
 	uint16 _offsetLookupSaidCount;
 
+	/**
+	 * Index of the decoded instruction starting at each offset of the script
+	 * block, plus one. Zero means that the instruction has not been decoded
+	 * yet.
+	 */
+	Common::Array<uint16> _decodedInstructionIndex;
+	Common::Array<DecodedInstruction> _decodedInstructions;
+
 public:
 	int getLocalsOffset() const { return _localsOffset; }
 	uint16 getLocalsCount() const { return _localsCount; }
@@ -154,6 +172,21 @@ public:
 	Object *getObject(uint32 offset);
 	const Object *getObject(uint32 offset) const;
 
+	/**
+	 * Decodes the instruction at the given offset. Instructions are decoded
+	 * the first time they are requested and cached until the script is
+	 * unloaded, reloaded or invalidateDecodedInstructions() is called.
+	 * @param offset	Offset of the instruction within the script buffer
+	 * @param instr		Receives the decoded instruction
+	 */
+	void getDecodedInstruction(uint32 offset, DecodedInstruction &instr);
+
+	/**
+	 * Drops all cached decoded instructions. Must be called whenever the
+	 * script's code is modified after it has been loaded.
+	 */
+	void invalidateDecodedInstructions();
+
 	/**
 	 * Initializes an object within the segment manager
 	 * @param obj_pos	Location (segment, offset) of the object. It must
@@ -42,6 +42,9 @@ SegManager::SegManager(ResourceManager *resMan, ScriptPatcher *scriptPatcher)
 	_saveDirPtr = NULL_REG;
 	_parserPtr = NULL_REG;
 
+	_selectorCacheGeneration = 1;
+	resetSelectorCacheStats();
+
 #ifdef ENABLE_SCI32
 	_arraysSegId = 0;
 	_bitmapSegId = 0;
@@ -79,6 +82,21 @@ void SegManager::resetSegMan() {
 	// Reinitialize class table
 	_classTable.clear();
 	createClassTable();
+
+	invalidateSelectorCaches();
+}
+
+void SegManager::invalidateSelectorCaches() {
+	// Generation 0 marks an empty object cache, so skip it on wrap-around
+	if (++_selectorCacheGeneration == 0)
+		_selectorCacheGeneration = 1;
+	++_selectorCacheStats.invalidations;
+}
+
+void SegManager::resetSelectorCacheStats() {
+	_selectorCacheStats.hits = 0;
+	_selectorCacheStats.misses = 0;
+	_selectorCacheStats.invalidations = 0;
 }
 
 void SegManager::initSysStrings() {
@@ -177,6 +195,7 @@ void SegManager::deallocate(SegmentId seg) {
 			if (_heap[scr->getLocalsSegment()])
 				deallocate(scr->getLocalsSegment());
 		}
+		invalidateSelectorCaches();
 	}
 
 	delete mobj;
@@ -1099,6 +1118,7 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 #ifdef ENABLE_SCI32
 	g_sci->_guestAdditions->instantiateScriptHook(*scr);
 #endif
+	invalidateSelectorCaches();
 
 	return segmentId;
 }
@@ -1130,6 +1150,7 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (!scr->getLockers()) {
 		// The actual script deletion seems to be done by SCI scripts themselves
 		scr->markDeleted();
+		invalidateSelectorCaches();
 		debugC(kDebugLevelScripts, "Unloaded script 0x%x.", script_nr);
 	}
 }
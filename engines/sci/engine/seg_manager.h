@@ -127,6 +127,32 @@ public:
 private:
 	void uninstantiateScriptSci0(int script_nr);
 
+public:
+	/**
+	 * Counters for the per-object selector lookup caches, shown by the
+	 * debugger's script_steps command.
+	 */
+	struct SelectorCacheStats {
+		uint32 hits;
+		uint32 misses;
+		uint32 invalidations;
+	};
+
+	/**
+	 * Returns the current selector cache generation. Cached selector lookups
+	 * recorded under an older generation are ignored.
+	 */
+	uint32 getSelectorCacheGeneration() const { return _selectorCacheGeneration; }
+
+	/**
+	 * Invalidates all cached selector lookups. Called whenever scripts are
+	 * loaded or unloaded, since classes may then move or disappear.
+	 */
+	void invalidateSelectorCaches();
+
+	SelectorCacheStats &getSelectorCacheStats() { return _selectorCacheStats; }
+	void resetSelectorCacheStats();
+
 public:
 	// TODO: document this
 	reg_t getClassAddress(int classnr, ScriptLoadType lock, uint16 callerSegment, bool applyScriptPatches = true);
@@ -476,6 +502,9 @@ private:
 	SegmentId _nodesSegId; ///< ID of the (a) node segment
 	SegmentId _hunksSegId; ///< ID of the (a) hunk segment
 
+	uint32 _selectorCacheGeneration; ///< Generation of the per-object selector caches
+	SelectorCacheStats _selectorCacheStats;
+
 	// Statically allocated memory for system strings
 	reg_t _saveDirPtr;
 	reg_t _parserPtr;
@@ -342,6 +342,24 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x, %s", PRINT_REG(obj_location), origin.toString().c_str());
 	}
 
+	// Repeated sends of the same selector to the same object are very common,
+	// so check the object's lookup cache before walking the class chain
+	const uint32 generation = segMan->getSelectorCacheGeneration();
+	SegManager::SelectorCacheStats &stats = segMan->getSelectorCacheStats();
+	const Object::SelectorCacheEntry *cached = obj->getCachedSelector(selectorId, generation);
+	if (cached) {
+		stats.hits++;
+		if (cached->type == kSelectorVariable && varp) {
+			varp->obj = obj_location;
+			varp->varindex = cached->varIndex;
+		} else if (cached->type == kSelectorMethod && fptr) {
+			*fptr = cached->funcPos;
+		}
+		return cached->type;
+	}
+	stats.misses++;
+
+	const Object *receiver = obj;
 	index = obj->locateVarSelector(segMan, selectorId);
 
 	if (index >= 0) {
@@ -350,21 +368,25 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 			varp->obj = obj_location;
 			varp->varindex = index;
 		}
+		receiver->cacheSelector(selectorId, generation, kSelectorVariable, index, NULL_REG);
 		return kSelectorVariable;
 	} else {
 		// Check if it's a method, with recursive lookup in superclasses
 		while (obj) {
 			index = obj->funcSelectorPosition(selectorId);
 			if (index >= 0) {
+				const reg_t funcPos = obj->getFunction(index);
 				if (fptr)
-					*fptr = obj->getFunction(index);
+					*fptr = funcPos;
 
+				receiver->cacheSelector(selectorId, generation, kSelectorMethod, -1, funcPos);
 				return kSelectorMethod;
 			} else {
 				obj = segMan->getObject(obj->getSuperClassSelector());
 			}
 		}
 
+		receiver->cacheSelector(selectorId, generation, kSelectorNone, -1, NULL_REG);
 		return kSelectorNone;
 	}
 
@@ -18,12 +18,14 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  *
  */
+#include "common/config-manager.h"
 #include "common/system.h"
 
 #include "sci/sci.h"	// for INCLUDE_OLDGFX
 #include "sci/debug.h"	// for g_debug_sleeptime_factor
 #include "sci/engine/features.h"
 #include "sci/engine/file.h"
+#include "sci/engine/gc.h"
 #include "sci/engine/guest_additions.h"
 #include "sci/engine/kernel.h"
 #include "sci/engine/state.h"
@@ -68,13 +70,17 @@ static const uint16 s_halfWidthSJISMap[256] = {
 
 EngineState::EngineState(SegManager *segMan)
 : _segMan(segMan),
-	_dirseeker() {
+	_dirseeker(),
+	gcContext(nullptr) {
+
+	memset(&gcStats, 0, sizeof(gcStats));
 
 	reset(false);
 }
 
 EngineState::~EngineState() {
 	delete _msgState;
+	delete gcContext;
 }
 
 void EngineState::reset(bool isRestoring) {
@@ -120,6 +126,9 @@ void EngineState::reset(bool isRestoring) {
 	_cursorWorkaroundActive = false;
 
 	scriptStepCounter = 0;
+	scriptStepStartTime = g_system->getMillis();
+	// Allows comparing against the plain interpreter when benchmarking
+	scriptPredecode = !ConfMan.hasKey("sci_predecode") || ConfMan.getBool("sci_predecode");
 	scriptGCInterval = GC_INTERVAL;
 }
 
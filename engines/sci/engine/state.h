@@ -97,6 +97,21 @@ struct SciCallOrigin {
 	}
 };
 
+/**
+ * Pause time and size information about garbage collector runs.
+ */
+struct GCStats {
+	uint32 runs;        ///< Number of collections since the last reset
+	uint32 lastPause;   ///< Duration of the last collection, in ms
+	uint32 maxPause;    ///< Longest collection, in ms
+	uint32 totalPause;  ///< Time spent in all collections, in ms
+	uint32 lastReachable; ///< Number of reachable addresses found by the last collection
+	uint32 lastFreed;   ///< Number of objects freed by the last collection
+	uint32 totalFreed;  ///< Number of objects freed by all collections
+};
+
+struct GCContext;
+
 struct EngineState : public Common::Serializable {
 public:
 	EngineState(SegManager *segMan);
@@ -177,6 +192,8 @@ public:
 	int16 gameIsRestarting; // is set when restarting (=1) or restoring the game (=2)
 
 	int scriptStepCounter; // Counts the number of steps executed
+	uint32 scriptStepStartTime; // Time at which scriptStepCounter was last reset
+	bool scriptPredecode; // Cache decoded instructions, see Script::getDecodedInstruction()
 	int scriptGCInterval; // Number of steps in between gcs
 
 	uint16 currentRoomNumber() const;
@@ -194,6 +211,8 @@ public:
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStats gcStats; /**< Statistics of past gc runs */
+	GCContext *gcContext; /**< Buffers kept between gc runs, see run_gc() */
 
 	MessageState *_msgState;
 
@@ -440,6 +440,10 @@ Common::Error SciEngine::run() {
 
 	runGame();
 
+	const uint32 scriptTime = g_system->getMillis() - _gamestate->scriptStepStartTime;
+	debugC(kDebugLevelVM, "Executed %d SCI operations in %u ms (%u per second)", _gamestate->scriptStepCounter,
+		scriptTime, scriptTime ? (uint)((uint64)_gamestate->scriptStepCounter * 1000 / scriptTime) : 0);
+
 	ConfMan.flushToDisk();
 
 	return Common::kNoError;
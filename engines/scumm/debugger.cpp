@@ -102,6 +102,8 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 #endif
 
 	registerCmd("resetcursors",    WRAP_METHOD(ScummDebugger, Cmd_ResetCursors));
+
+	registerCmd("opcodes",   WRAP_METHOD(ScummDebugger, Cmd_Opcodes));
 }
 
 ScummDebugger::~ScummDebugger() {
@@ -1029,4 +1031,22 @@ bool ScummDebugger::Cmd_ResetCursors(int argc, const char **argv) {
 	return false;
 }
 
+bool ScummDebugger::Cmd_Opcodes(int argc, const char **argv) {
+	if (argc > 1 && !strcmp(argv[1], "reset")) {
+		_vm->resetOpcodeCount();
+		debugPrintf("Opcode counters reset\n");
+		return true;
+	}
+
+	const uint32 elapsed = _vm->_system->getMillis() - _vm->_opcodeCountStartTime;
+	const uint32 busy = _vm->_opcodeCountBusyTime;
+	debugPrintf("Executed %u opcodes in %u ms, %u ms of which were spent running the main loop\n",
+		_vm->_opcodeCount, elapsed, busy);
+	debugPrintf("Opcodes per second: %u, per busy second: %u\n",
+		elapsed ? (uint)((uint64)_vm->_opcodeCount * 1000 / elapsed) : 0,
+		busy ? (uint)((uint64)_vm->_opcodeCount * 1000 / busy) : 0);
+	debugPrintf("Use 'opcodes reset' to reset the counters\n");
+	return true;
+}
+
 } // End of namespace Scumm
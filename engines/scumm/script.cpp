@@ -447,12 +447,10 @@ void ScummEngine::resetScriptPointer() {
  * The script resource may have moved because it might have been garbage
  * collected by ResourceManager::expireResources.
  */
-void ScummEngine::refreshScriptPointer() {
-	if (*_lastCodePtr != _scriptOrgPointer) {
-		long oldoffs = _scriptPointer - _scriptOrgPointer;
-		getScriptBaseAddress();
-		_scriptPointer = _scriptOrgPointer + oldoffs;
-	}
+void ScummEngine::relocateScriptPointer() {
+	long oldoffs = _scriptPointer - _scriptOrgPointer;
+	getScriptBaseAddress();
+	_scriptPointer = _scriptOrgPointer + oldoffs;
 }
 
 /** Execute a script - Read opcode, and execute it from the table */
@@ -488,13 +486,20 @@ void ScummEngine::executeScript() {
 }
 
 void ScummEngine::executeOpcode(byte i) {
-	if (_opcodes[i].proc && _opcodes[i].proc->isValid())
-		(*_opcodes[i].proc)();
+	_opcodeCount++;
+	if (_opcodes[i].proc)
+		_opcodes[i].proc(this);
 	else {
 		error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
 	}
 }
 
+void ScummEngine::resetOpcodeCount() {
+	_opcodeCount = 0;
+	_opcodeCountStartTime = _system->getMillis();
+	_opcodeCountBusyTime = 0;
+}
+
 const char *ScummEngine::getOpcodeDesc(byte i) {
 #ifndef REDUCE_MEMORY_USAGE
 	return _opcodes[i].desc;
@@ -503,11 +508,6 @@ const char *ScummEngine::getOpcodeDesc(byte i) {
 #endif
 }
 
-byte ScummEngine::fetchScriptByte() {
-	refreshScriptPointer();
-	return *_scriptPointer++;
-}
-
 uint ScummEngine::fetchScriptWord() {
 	refreshScriptPointer();
 	uint a = READ_LE_UINT16(_scriptPointer);
@@ -519,17 +519,6 @@ int ScummEngine::fetchScriptWordSigned() {
 	return (int16)fetchScriptWord();
 }
 
-uint ScummEngine::fetchScriptDWord() {
-	refreshScriptPointer();
-	uint a = READ_LE_UINT32(_scriptPointer);
-	_scriptPointer += 4;
-	return a;
-}
-
-int ScummEngine::fetchScriptDWordSigned() {
-	return (int32)fetchScriptDWord();
-}
-
 int ScummEngine::readVar(uint var) {
 	int a;
 
@@ -22,14 +22,27 @@
 #ifndef SCUMM_SCRIPT_H
 #define SCUMM_SCRIPT_H
 
-#include "common/func.h"
+#include "common/noncopyable.h"
 
 namespace Scumm {
 
-typedef Common::Functor0<void> Opcode;
+class ScummEngine;
+
+typedef void (*OpcodeProc)(ScummEngine *engine);
+
+/**
+ * Calls the opcode handler @p func on @p engine. The compiler generates one
+ * of these for every handler registered with OPCODE(), so dispatching an
+ * opcode is a single indirect call, and the handler itself can be inlined
+ * into it.
+ */
+template<class T, class F, F func>
+void invokeOpcode(ScummEngine *engine) {
+	(static_cast<T *>(engine)->*func)();
+}
 
 struct OpcodeEntry : Common::NonCopyable {
-	Opcode *proc;
+	OpcodeProc proc;
 #ifndef REDUCE_MEMORY_USAGE
 	const char *desc;
 #endif
@@ -39,15 +52,9 @@ struct OpcodeEntry : Common::NonCopyable {
 #else
 	OpcodeEntry() : proc(0) {}
 #endif
-	~OpcodeEntry() {
-		setProc(0, 0);
-	}
 
-	void setProc(Opcode *p, const char *d) {
-		if (proc != p) {
-			delete proc;
-			proc = p;
-		}
+	void setProc(OpcodeProc p, const char *d) {
+		proc = p;
 #ifndef REDUCE_MEMORY_USAGE
 		desc = d;
 #endif
@@ -58,9 +65,9 @@ struct OpcodeEntry : Common::NonCopyable {
 // This is to help devices with small memory (PDA, smartphones, ...)
 // to save abit of memory used by opcode names in the Scumm engine.
 #ifndef REDUCE_MEMORY_USAGE
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), #x)
+#	define _OPCODE(ver, x)	setProc(&invokeOpcode<ver, decltype(&ver::x), &ver::x>, #x)
 #else
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), "")
+#	define _OPCODE(ver, x)	setProc(&invokeOpcode<ver, decltype(&ver::x), &ver::x>, "")
 #endif
 
 /**
@@ -215,6 +215,9 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 	_scriptPointer = nullptr;
 	_scriptOrgPointer = nullptr;
 	_opcode = 0;
+	_opcodeCount = 0;
+	_opcodeCountStartTime = 0;
+	_opcodeCountBusyTime = 0;
 	vm.numNestedScripts = 0;
 	_lastCodePtr = nullptr;
 	_scummStackPos = 0;
@@ -2398,6 +2401,8 @@ Common::Error ScummEngine::go() {
 
 	int diff = 0;	// Duration of one loop iteration
 
+	resetOpcodeCount();
+
 	while (!shouldQuit()) {
 		// Randomize the PRNG by calling it at regular intervals. This ensures
 		// that it will be in a different state each time you run the program.
@@ -2456,6 +2461,7 @@ Common::Error ScummEngine::go() {
 
 		// Halt the stop watch and compute how much time this iteration took.
 		diff = _system->getMillis() - diff;
+		_opcodeCountBusyTime += diff;
 
 
 		if (shouldQuit()) {
@@ -2464,6 +2470,9 @@ Common::Error ScummEngine::go() {
 		}
 	}
 
+	debug(1, "Executed %u opcodes, %u per busy second", _opcodeCount,
+		_opcodeCountBusyTime ? (uint)((uint64)_opcodeCount * 1000 / _opcodeCountBusyTime) : 0);
+
 	return Common::kNoError;
 }
 
@@ -562,6 +562,12 @@ protected:
 
 	OpcodeEntry _opcodes[256];
 
+	/* Instruction rate counters, shown by the debugger's "opcodes" command */
+	uint32 _opcodeCount;           ///< Number of opcodes executed since the last reset
+	uint32 _opcodeCountStartTime;  ///< Time of the last reset, in ms
+	uint32 _opcodeCountBusyTime;   ///< Time spent in scummLoop() since the last reset, in ms
+	void resetOpcodeCount();
+
 	virtual void setupOpcodes() = 0;
 	void executeOpcode(byte i);
 	const char *getOpcodeDesc(byte i);
@@ -607,12 +613,25 @@ protected:
 	void resetScriptPointer();
 	int getVerbEntrypoint(int obj, int entry);
 
-	void refreshScriptPointer();
-	byte fetchScriptByte();
+	void refreshScriptPointer() {
+		// The script resource may have moved since the pointer was set up
+		if (*_lastCodePtr != _scriptOrgPointer)
+			relocateScriptPointer();
+	}
+	void relocateScriptPointer();
+	byte fetchScriptByte() {
+		refreshScriptPointer();
+		return *_scriptPointer++;
+	}
 	virtual uint fetchScriptWord();
 	virtual int fetchScriptWordSigned();
-	uint fetchScriptDWord();
-	int fetchScriptDWordSigned();
+	uint fetchScriptDWord() {
+		refreshScriptPointer();
+		uint a = READ_LE_UINT32(_scriptPointer);
+		_scriptPointer += 4;
+		return a;
+	}
+	int fetchScriptDWordSigned() { return (int32)fetchScriptDWord(); }
 	void ignoreScriptWord() { fetchScriptWord(); }
 	void ignoreScriptByte() { fetchScriptByte(); }
 	void push(int a);
@@ -98,6 +98,95 @@ void TinyGLActorRenderer::render(const Math::Vector3d &position, float direction
 	Common::Array<Material *> mats = _model->getMaterials();
 	const Common::Array<BoneNode *> &bones = _model->getBones();
 
+	// The vertices only need skinning again when the pose changed
+	computeBonePalette(bones);
+	if (_bonePalette.size() != _skinnedPalette.size() ||
+	        memcmp(_bonePalette.data(), _skinnedPalette.data(), _bonePalette.size() * sizeof(float)) != 0) {
+		skinVertices();
+		_skinnedPalette = _bonePalette;
+	}
+
+	static const uint maxLights = 10;
+
+	assert(lights.size() >= 1);
+	assert(lights.size() <= maxLights);
+
+	const LightEntry *ambient = lights[0];
+	assert(ambient->type == LightEntry::kAmbient); // The first light must be the ambient light
+
+	Math::Matrix3 normalRotation = normalMatrix.getRotation();
+
+	// Light each vertex once, the faces only apply their material color
+	uint vertexCount = _skinning.boneWeight.size();
+	for (uint index = 0; index < vertexCount; index++) {
+		ActorVertex &vertex = _faceVBO[index];
+		Math::Vector3d modelPosition = Math::Vector3d(vertex.x, vertex.y, vertex.z);
+		Math::Vector3d modelNormal = Math::Vector3d(vertex.nx, vertex.ny, vertex.nz);
+
+		// Compute the vertex position in eye-space
+		Math::Vector4d modelEyePosition;
+		modelEyePosition = modelViewMatrix * Math::Vector4d(modelPosition.x(),
+		                                                    modelPosition.y(),
+		                                                    modelPosition.z(),
+		                                                    1.0);
+		// Compute the vertex normal in eye-space
+		Math::Vector3d modelEyeNormal;
+		modelEyeNormal = normalRotation * modelNormal;
+		modelEyeNormal.normalize();
+
+		if (drawShadow) {
+			Math::Vector3d shadowPosition = modelPosition + lightDirection * (-modelPosition.y() / lightDirection.y());
+			vertex.sx = shadowPosition.x();
+			vertex.sy = 0.0f;
+			vertex.sz = shadowPosition.z();
+		}
+
+		Math::Vector3d lightColor = ambient->color;
+
+		for (uint li = 0; li < lights.size() - 1; li++) {
+			const LightEntry *l = lights[li + 1];
+
+			switch (l->type) {
+				case LightEntry::kPoint: {
+					Math::Vector3d vertexToLight = l->eyePosition.getXYZ() - modelEyePosition.getXYZ();
+
+					float dist = vertexToLight.length();
+					vertexToLight.normalize();
+					float attn = CLIP((l->falloffFar - dist) / MAX(0.001f,  l->falloffFar - l->falloffNear), 0.0f, 1.0f);
+					float incidence = MAX(0.0f, Math::Vector3d::dotProduct(modelEyeNormal, vertexToLight));
+					lightColor += l->color * attn * incidence;
+					break;
+				}
+				case LightEntry::kDirectional: {
+					float incidence = MAX(0.0f, Math::Vector3d::dotProduct(modelEyeNormal, -l->eyeDirection));
+					lightColor += (l->color * incidence);
+					break;
+				}
+				case LightEntry::kSpot: {
+					Math::Vector3d vertexToLight = l->eyePosition.getXYZ() - modelEyePosition.getXYZ();
+
+					float dist = vertexToLight.length();
+					float attn = CLIP((l->falloffFar - dist) / MAX(0.001f, l->falloffFar - l->falloffNear), 0.0f, 1.0f);
+
+					vertexToLight.normalize();
+					float incidence = MAX(0.0f, modelEyeNormal.dotProduct(vertexToLight));
+
+					float cosAngle = MAX(0.0f, vertexToLight.dotProduct(-l->eyeDirection));
+					float cone = CLIP((cosAngle - l->innerConeAngle.getCosine()) / MAX(0.001f, l->outerConeAngle.getCosine() - l->innerConeAngle.getCosine()), 0.0f, 1.0f);
+
+					lightColor += l->color * attn * incidence * cone;
+					break;
+				}
+				default:
+					break;
+			}
+		}
+
+		_lightR[index] = CLIP(lightColor.x(), 0.0f, 1.0f);
+		_lightG[index] = CLIP(lightColor.y(), 0.0f, 1.0f);
+		_lightB[index] = CLIP(lightColor.z(), 0.0f, 1.0f);
+	}
+
 	for (Common::Array<Face *>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
 		const Material *material = mats[(*face)->materialId];
 		Math::Vector3d color;
@@ -105,132 +194,20 @@ void TinyGLActorRenderer::render(const Math::Vector3d &position, float direction
 		if (tex) {
 			tex->bind();
 			tglEnable(TGL_TEXTURE_2D);
+			color = Math::Vector3d(1.0f, 1.0f, 1.0f);
 		} else {
 			tglBindTexture(TGL_TEXTURE_2D, 0);
 			tglDisable(TGL_TEXTURE_2D);
+			color = Math::Vector3d(material->r, material->g, material->b);
 		}
 		auto vertexIndices = _faceEBO[*face];
 		auto numVertexIndices = (*face)->vertexIndices.size();
 		for (uint32 i = 0; i < numVertexIndices; i++) {
-			if (tex) {
-				color = Math::Vector3d(1.0f, 1.0f, 1.0f);
-			} else {
-				color = Math::Vector3d(material->r, material->g, material->b);
-			}
 			uint32 index = vertexIndices[i];
-			auto vertex = _faceVBO[index];
-			uint32 bone1 = vertex.bone1;
-			uint32 bone2 = vertex.bone2;
-			Math::Vector3d position1 = Math::Vector3d(vertex.pos1x, vertex.pos1y, vertex.pos1z);
-			Math::Vector3d position2 = Math::Vector3d(vertex.pos2x, vertex.pos2y, vertex.pos2z);
-			Math::Vector3d bone1Position = Math::Vector3d(bones[bone1]->_animPos.x(),
-			                                              bones[bone1]->_animPos.y(),
-			                                              bones[bone1]->_animPos.z());
-			Math::Vector3d bone2Position = Math::Vector3d(bones[bone2]->_animPos.x(),
-			                                              bones[bone2]->_animPos.y(),
-			                                              bones[bone2]->_animPos.z());
-			Math::Quaternion bone1Rotation = Math::Quaternion(bones[bone1]->_animRot.x(),
-			                                                  bones[bone1]->_animRot.y(),
-			                                                  bones[bone1]->_animRot.z(),
-			                                                  bones[bone1]->_animRot.w());
-			Math::Quaternion bone2Rotation = Math::Quaternion(bones[bone2]->_animRot.x(),
-			                                                  bones[bone2]->_animRot.y(),
-			                                                  bones[bone2]->_animRot.z(),
-			                                                  bones[bone2]->_animRot.w());
-			float boneWeight = vertex.boneWeight;
-			Math::Vector3d normal = Math::Vector3d(vertex.normalx, vertex.normaly, vertex.normalz);
-
-			// Compute the vertex position in eye-space
-			bone1Rotation.transform(position1);
-			position1 += bone1Position;
-			bone2Rotation.transform(position2);
-			position2 += bone2Position;
-			Math::Vector3d modelPosition = Math::Vector3d::interpolate(position2, position1, boneWeight);
-			vertex.x = modelPosition.x();
-			vertex.y = modelPosition.y();
-			vertex.z = modelPosition.z();
-			Math::Vector4d modelEyePosition;
-			modelEyePosition = modelViewMatrix * Math::Vector4d(modelPosition.x(),
-			                                                    modelPosition.y(),
-			                                                    modelPosition.z(),
-			                                                    1.0);
-			// Compute the vertex normal in eye-space
-			Math::Vector3d n1 = normal;
-			bone1Rotation.transform(n1);
-			Math::Vector3d n2 = normal;
-			bone2Rotation.transform(n2);
-			Math::Vector3d modelNormal = Math::Vector3d(Math::Vector3d::interpolate(n2, n1, boneWeight)).getNormalized();
-			vertex.nx = modelNormal.x();
-			vertex.ny = modelNormal.y();
-			vertex.nz = modelNormal.z();
-			Math::Vector3d modelEyeNormal;
-			modelEyeNormal = normalMatrix.getRotation() * modelNormal;
-			modelEyeNormal.normalize();
-
-			if (drawShadow) {
-				Math::Vector3d shadowPosition = modelPosition + lightDirection * (-modelPosition.y() / lightDirection.y());
-				vertex.sx = shadowPosition.x();
-				vertex.sy = 0.0f;
-				vertex.sz = shadowPosition.z();
-			}
-
-			static const uint maxLights = 10;
-
-			assert(lights.size() >= 1);
-			assert(lights.size() <= maxLights);
-
-			const LightEntry *ambient = lights[0];
-			assert(ambient->type == LightEntry::kAmbient); // The first light must be the ambient light
-
-			Math::Vector3d lightColor = ambient->color;
-
-			for (uint li = 0; li < lights.size() - 1; li++) {
-				const LightEntry *l = lights[li + 1];
-
-				switch (l->type) {
-					case LightEntry::kPoint: {
-						Math::Vector3d vertexToLight = l->eyePosition.getXYZ() - modelEyePosition.getXYZ();
-
-						float dist = vertexToLight.length();
-						vertexToLight.normalize();
-						float attn = CLIP((l->falloffFar - dist) / MAX(0.001f,  l->falloffFar - l->falloffNear), 0.0f, 1.0f);
-						float incidence = MAX(0.0f, Math::Vector3d::dotProduct(modelEyeNormal, vertexToLight));
-						lightColor += l->color * attn * incidence;
-						break;
-					}
-					case LightEntry::kDirectional: {
-						float incidence = MAX(0.0f, Math::Vector3d::dotProduct(modelEyeNormal, -l->eyeDirection));
-						lightColor += (l->color * incidence);
-						break;
-					}
-					case LightEntry::kSpot: {
-						Math::Vector3d vertexToLight = l->eyePosition.getXYZ() - modelEyePosition.getXYZ();
-
-						float dist = vertexToLight.length();
-						float attn = CLIP((l->falloffFar - dist) / MAX(0.001f, l->falloffFar - l->falloffNear), 0.0f, 1.0f);
-
-						vertexToLight.normalize();
-						float incidence = MAX(0.0f, modelEyeNormal.dotProduct(vertexToLight));
-
-						float cosAngle = MAX(0.0f, vertexToLight.dotProduct(-l->eyeDirection));
-						float cone = CLIP((cosAngle - l->innerConeAngle.getCosine()) / MAX(0.001f, l->outerConeAngle.getCosine() - l->innerConeAngle.getCosine()), 0.0f, 1.0f);
-
-						lightColor += l->color * attn * incidence * cone;
-						break;
-					}
-					default:
-						break;
-				}
-			}
-
-			lightColor.x() = CLIP(lightColor.x(), 0.0f, 1.0f);
-			lightColor.y() = CLIP(lightColor.y(), 0.0f, 1.0f);
-			lightColor.z() = CLIP(lightColor.z(), 0.0f, 1.0f);
-			color = color * lightColor;
-			vertex.r = color.x();
-			vertex.g = color.y();
-			vertex.b = color.z();
-			_faceVBO[index] = vertex;
+			ActorVertex &vertex = _faceVBO[index];
+			vertex.r = color.x() * _lightR[index];
+			vertex.g = color.y() * _lightG[index];
+			vertex.b = color.z() * _lightB[index];
 		}
 
 		tglEnableClientState(TGL_VERTEX_ARRAY);
@@ -280,6 +257,19 @@ void TinyGLActorRenderer::clearVertices() {
 	delete[] _faceVBO;
 	_faceVBO = nullptr;
 
+	for (uint i = 0; i < 3; i++) {
+		_skinning.pos1[i].clear();
+		_skinning.pos2[i].clear();
+		_skinning.normal[i].clear();
+	}
+	_skinning.boneWeight.clear();
+	_skinning.bone1.clear();
+	_skinning.bone2.clear();
+	_lightR.clear();
+	_lightG.clear();
+	_lightB.clear();
+	_skinnedPalette.clear();
+
 	for (FaceBufferMap::iterator it = _faceEBO.begin(); it != _faceEBO.end(); ++it) {
 		delete[] it->_value;
 	}
@@ -289,6 +279,7 @@ void TinyGLActorRenderer::clearVertices() {
 
 void TinyGLActorRenderer::uploadVertices() {
 	_faceVBO = createModelVBO(_model);
+	createSkinningData(_model);
 
 	Common::Array<Face *> faces = _model->getFaces();
 	for (Common::Array<Face *>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
@@ -322,6 +313,103 @@ ActorVertex *TinyGLActorRenderer::createModelVBO(const Model *model) {
 	return vertices;
 }
 
+void TinyGLActorRenderer::createSkinningData(const Model *model) {
+	const Common::Array<VertNode *> &modelVertices = model->getVertices();
+
+	uint count = modelVertices.size();
+	for (uint i = 0; i < 3; i++) {
+		_skinning.pos1[i].resize(count);
+		_skinning.pos2[i].resize(count);
+		_skinning.normal[i].resize(count);
+	}
+	_skinning.boneWeight.resize(count);
+	_skinning.bone1.resize(count);
+	_skinning.bone2.resize(count);
+	_lightR.resize(count);
+	_lightG.resize(count);
+	_lightB.resize(count);
+
+	for (uint i = 0; i < count; i++) {
+		const VertNode *vert = modelVertices[i];
+		for (uint j = 0; j < 3; j++) {
+			_skinning.pos1[j][i] = vert->_pos1.getValue(j);
+			_skinning.pos2[j][i] = vert->_pos2.getValue(j);
+			_skinning.normal[j][i] = vert->_normal.getValue(j);
+		}
+		_skinning.boneWeight[i] = vert->_boneWeight;
+		_skinning.bone1[i] = vert->_bone1 * kBoneMatrixSize;
+		_skinning.bone2[i] = vert->_bone2 * kBoneMatrixSize;
+	}
+}
+
+void TinyGLActorRenderer::computeBonePalette(const Common::Array<BoneNode *> &bones) {
+	_bonePalette.resize(bones.size() * kBoneMatrixSize);
+
+	for (uint i = 0; i < bones.size(); i++) {
+		const Math::Quaternion &q = bones[i]->_animRot;
+		const Math::Vector3d &t = bones[i]->_animPos;
+		float *m = &_bonePalette[i * kBoneMatrixSize];
+
+		// Same rotation as Math::Quaternion::transform, as a 3x4 row-major matrix
+		float x = q.x(), y = q.y(), z = q.z(), w = q.w();
+		float two_xx = x * (x + x), two_xy = x * (y + y), two_xz = x * (z + z);
+		float two_wx = w * (x + x), two_wy = w * (y + y), two_wz = w * (z + z);
+		float two_yy = y * (y + y), two_yz = y * (z + z), two_zz = z * (z + z);
+
+		m[0] = 1.0f - (two_yy + two_zz); m[1] = two_xy - two_wz;          m[2]  = two_xz + two_wy;          m[3]  = t.x();
+		m[4] = two_xy + two_wz;          m[5] = 1.0f - (two_xx + two_zz); m[6]  = two_yz - two_wx;          m[7]  = t.y();
+		m[8] = two_xz - two_wy;          m[9] = two_yz + two_wx;          m[10] = 1.0f - (two_xx + two_yy); m[11] = t.z();
+	}
+}
+
+void TinyGLActorRenderer::skinVertices() {
+	const float *palette = _bonePalette.data();
+	const float *pos1x = _skinning.pos1[0].data(), *pos1y = _skinning.pos1[1].data(), *pos1z = _skinning.pos1[2].data();
+	const float *pos2x = _skinning.pos2[0].data(), *pos2y = _skinning.pos2[1].data(), *pos2z = _skinning.pos2[2].data();
+	const float *normalx = _skinning.normal[0].data(), *normaly = _skinning.normal[1].data(), *normalz = _skinning.normal[2].data();
+	const float *weights = _skinning.boneWeight.data();
+	const uint32 *bone1 = _skinning.bone1.data();
+	const uint32 *bone2 = _skinning.bone2.data();
+
+	// Straight-line code over the vertex streams, without
+	// any branches, so the compiler is able to vectorize it
+	uint count = _skinning.boneWeight.size();
+	for (uint i = 0; i < count; i++) {
+		const float *m1 = palette + bone1[i];
+		const float *m2 = palette + bone2[i];
+		float w1 = weights[i];
+		float w2 = 1.0f - w1;
+
+		float p1x = m1[0] * pos1x[i] + m1[1] * pos1y[i] + m1[2]  * pos1z[i] + m1[3];
+		float p1y = m1[4] * pos1x[i] + m1[5] * pos1y[i] + m1[6]  * pos1z[i] + m1[7];
+		float p1z = m1[8] * pos1x[i] + m1[9] * pos1y[i] + m1[10] * pos1z[i] + m1[11];
+		float p2x = m2[0] * pos2x[i] + m2[1] * pos2y[i] + m2[2]  * pos2z[i] + m2[3];
+		float p2y = m2[4] * pos2x[i] + m2[5] * pos2y[i] + m2[6]  * pos2z[i] + m2[7];
+		float p2z = m2[8] * pos2x[i] + m2[9] * pos2y[i] + m2[10] * pos2z[i] + m2[11];
+
+		float n1x = m1[0] * normalx[i] + m1[1] * normaly[i] + m1[2]  * normalz[i];
+		float n1y = m1[4] * normalx[i] + m1[5] * normaly[i] + m1[6]  * normalz[i];
+		float n1z = m1[8] * normalx[i] + m1[9] * normaly[i] + m1[10] * normalz[i];
+		float n2x = m2[0] * normalx[i] + m2[1] * normaly[i] + m2[2]  * normalz[i];
+		float n2y = m2[4] * normalx[i] + m2[5] * normaly[i] + m2[6]  * normalz[i];
+		float n2z = m2[8] * normalx[i] + m2[9] * normaly[i] + m2[10] * normalz[i];
+
+		float nx = n2x * w2 + n1x * w1;
+		float ny = n2y * w2 + n1y * w1;
+		float nz = n2z * w2 + n1z * w1;
+		float length = sqrtf(nx * nx + ny * ny + nz * nz);
+		float scale = length > 0.0f ? 1.0f / length : 1.0f;
+
+		ActorVertex &vertex = _faceVBO[i];
+		vertex.x = p2x * w2 + p1x * w1;
+		vertex.y = p2y * w2 + p1y * w1;
+		vertex.z = p2z * w2 + p1z * w1;
+		vertex.nx = nx * scale;
+		vertex.ny = ny * scale;
+		vertex.nz = nz * scale;
+	}
+}
+
 uint32 *TinyGLActorRenderer::createFaceEBO(const Face *face) {
 	auto indices = new uint32[face->vertexIndices.size()];
 	for (uint32 index = 0; index < face->vertexIndices.size(); index++) {
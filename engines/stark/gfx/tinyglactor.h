@@ -28,10 +28,14 @@
 
 #include "graphics/tinygl/tinygl.h"
 
+#include "common/array.h"
 #include "common/hashmap.h"
 #include "common/hash-ptr.h"
 
 namespace Stark {
+
+class BoneNode;
+
 namespace Gfx {
 
 class TinyGLDriver;
@@ -66,6 +70,16 @@ struct _ActorVertex {
 };
 typedef _ActorVertex ActorVertex;
 
+/** The skinning inputs of the model vertices, with one array per component */
+struct ActorSkinningData {
+	Common::Array<float> pos1[3];
+	Common::Array<float> pos2[3];
+	Common::Array<float> normal[3];
+	Common::Array<float> boneWeight;
+	Common::Array<uint32> bone1; // Offsets in the bone palette
+	Common::Array<uint32> bone2;
+};
+
 class TinyGLActorRenderer : public VisualActor {
 public:
 	TinyGLActorRenderer(TinyGLDriver *gfx);
@@ -78,12 +92,25 @@ protected:
 
 	TinyGLDriver *_gfx;
 
+	// Size of a bone matrix in the palette: 3 rows of 4 floats
+	static const uint kBoneMatrixSize = 12;
+
 	ActorVertex *_faceVBO;
 	FaceBufferMap _faceEBO;
 
+	ActorSkinningData _skinning;
+	Common::Array<float> _bonePalette;
+	Common::Array<float> _skinnedPalette; // The palette _faceVBO was skinned with
+	Common::Array<float> _lightR;
+	Common::Array<float> _lightG;
+	Common::Array<float> _lightB;
+
 	void clearVertices();
 	void uploadVertices();
 	ActorVertex *createModelVBO(const Model *model);
+	void createSkinningData(const Model *model);
+	void computeBonePalette(const Common::Array<BoneNode *> &bones);
+	void skinVertices();
 	uint32 *createFaceEBO(const Face *face);
 	void setLightArrayUniform(const LightEntryArray &lights);
 
@@ -42,10 +42,13 @@
 #include "ultima/ultima8/misc/util.h"
 #include "ultima/ultima8/usecode/uc_machine.h"
 #include "ultima/ultima8/usecode/bit_set.h"
+#include "ultima/ultima8/usecode/uc_list.h"
 #include "ultima/ultima8/world/world.h"
 #include "ultima/ultima8/world/camera_process.h"
+#include "ultima/ultima8/world/current_map.h"
 #include "ultima/ultima8/world/get_object.h"
 #include "ultima/ultima8/world/item_factory.h"
+#include "ultima/ultima8/world/loop_script.h"
 #include "ultima/ultima8/world/actors/quick_avatar_mover_process.h"
 #include "ultima/ultima8/world/actors/avatar_mover_process.h"
 #include "ultima/ultima8/world/target_reticle_process.h"
@@ -144,6 +147,8 @@ Debugger::Debugger() : Shared::Debugger() {
 	registerCmd("GameMapGump::incrementSortOrder", WRAP_METHOD(Debugger, cmdIncrementSortOrder));
 	registerCmd("GameMapGump::decrementSortOrder", WRAP_METHOD(Debugger, cmdDecrementSortOrder));
 
+	registerCmd("CurrentMap::benchmarkSearches", WRAP_METHOD(Debugger, cmdBenchmarkMapSearches));
+
 	registerCmd("Kernel::processTypes", WRAP_METHOD(Debugger, cmdProcessTypes));
 	registerCmd("Kernel::processInfo", WRAP_METHOD(Debugger, cmdProcessInfo));
 	registerCmd("Kernel::listProcesses", WRAP_METHOD(Debugger, cmdListProcesses));
@@ -833,6 +838,90 @@ bool Debugger::cmdDumpAllMaps(int argc, const char **argv) {
 }
 
 
+static uint32 runMapSearchQueries(const CurrentMap *map, const Actor *av, int count) {
+	int32 ax, ay, az;
+	int32 xd, yd, zd;
+	av->getLocation(ax, ay, az);
+	av->getFootpadWorld(xd, yd, zd);
+	const uint32 shapeflags = av->getShapeInfo()->_flags;
+
+	LOOPSCRIPT(script, LS_TOKEN_TRUE);
+	uint32 seed = 0x1234567;
+	uint32 checksum = 0;
+	for (int i = 0; i < count; i++) {
+		seed = seed * 1103515245 + 12345;
+		const int32 x = ax + (int32)((seed >> 8) & 0x7FF) - 1024;
+		seed = seed * 1103515245 + 12345;
+		const int32 y = ay + (int32)((seed >> 8) & 0x7FF) - 1024;
+		seed = seed * 1103515245 + 12345;
+		const int32 z = az + (int32)((seed >> 8) & 0x7F) - 64;
+
+		const Item *support = nullptr;
+		const Item *blocker = nullptr;
+		ObjId roof = 0;
+		bool valid = map->isValidPosition(x, y, z, xd, yd, zd, shapeflags,
+		                                  av->getObjId(), &support, &roof, &blocker);
+		checksum = checksum * 31 + (valid ? 1 : 0);
+		checksum = checksum * 31 + (support ? support->getObjId() : 0);
+		checksum = checksum * 31 + (blocker ? blocker->getObjId() : 0);
+		checksum = checksum * 31 + roof;
+
+		UCList itemlist(2);
+		map->areaSearch(&itemlist, script, sizeof(script), nullptr, 256, false, x, y);
+		for (unsigned int j = 0; j < itemlist.getSize(); j++)
+			checksum = checksum * 31 + itemlist.getuint16(j);
+
+		UCList surfacelist(2);
+		int32 origin[3] = { x, y, z };
+		int32 dims[3] = { xd, yd, zd };
+		map->surfaceSearch(&surfacelist, script, sizeof(script), av->getObjId(),
+		                   origin, dims, true, true);
+		for (unsigned int j = 0; j < surfacelist.getSize(); j++)
+			checksum = checksum * 31 + surfacelist.getuint16(j);
+
+		int32 start[3] = { ax, ay, az };
+		int32 end[3] = { x, y, z };
+		Std::list<CurrentMap::SweepItem> hits;
+		map->sweepTest(start, end, dims, shapeflags, av->getObjId(), false, &hits);
+		for (Std::list<CurrentMap::SweepItem>::const_iterator it = hits.begin(); it != hits.end(); ++it)
+			checksum = checksum * 31 + it->_item + it->_hitTime;
+	}
+	return checksum;
+}
+
+bool Debugger::cmdBenchmarkMapSearches(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("usage: CurrentMap::benchmarkSearches [<count>]\n");
+		return true;
+	}
+
+	const MainActor *av = getMainActor();
+	if (!av) {
+		debugPrintf("No main actor.\n");
+		return true;
+	}
+
+	int count = argc > 1 ? atoi(argv[1]) : 10000;
+	if (count <= 0)
+		count = 10000;
+
+	CurrentMap *map = World::get_instance()->getCurrentMap();
+
+	uint32 startTime = g_system->getMillis();
+	const uint32 boxSum = runMapSearchQueries(map, av, count);
+	const uint32 boxTime = g_system->getMillis() - startTime;
+
+	map->setItemBoxesEnabled(false);
+	startTime = g_system->getMillis();
+	const uint32 listSum = runMapSearchQueries(map, av, count);
+	const uint32 listTime = g_system->getMillis() - startTime;
+	map->setItemBoxesEnabled(true);
+
+	debugPrintf("%d queries: item boxes %u ms, item lists %u ms, results %s\n",
+	            count, boxTime, listTime, boxSum == listSum ? "match" : "DIFFER");
+	return true;
+}
+
 bool Debugger::cmdIncrementSortOrder(int argc, const char **argv) {
 	int32 count = argc > 1 ? strtol(argv[1], 0, 0) : 1;
 	GameMapGump *gump = Ultima8Engine::get_instance()->getGameMapGump();
@@ -0,0 +1,135 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ULTIMA8_WORLD_CHUNKITEMBOXES_H
+#define ULTIMA8_WORLD_CHUNKITEMBOXES_H
+
+#include "common/array.h"
+
+namespace Ultima {
+namespace Ultima8 {
+
+class Item;
+
+/**
+ * The xy rectangles of the items in one map chunk, kept in the same order
+ * as the chunk's item list. The rectangles are stored as separate arrays so
+ * that searches can reject most items with a few vectorized compares,
+ * without touching the items themselves.
+ *
+ * Rectangles only need to contain the item's footprint; the exact tests are
+ * still done on the items which pass.
+ */
+class ChunkItemBoxes {
+public:
+	//! Maximum number of rectangles tested by one call to overlaps()
+	static const uint kBlockSize = 32;
+
+	uint size() const {
+		return _items.size();
+	}
+
+	Item *getItem(uint i) const {
+		return _items[i];
+	}
+
+	void clear() {
+		_items.clear();
+		_xMin.clear();
+		_yMin.clear();
+		_xMax.clear();
+		_yMax.clear();
+	}
+
+	void pushFront(Item *item, int32 xMin, int32 yMin, int32 xMax, int32 yMax) {
+		_items.insert_at(0, item);
+		_xMin.insert_at(0, xMin);
+		_yMin.insert_at(0, yMin);
+		_xMax.insert_at(0, xMax);
+		_yMax.insert_at(0, yMax);
+	}
+
+	void pushBack(Item *item, int32 xMin, int32 yMin, int32 xMax, int32 yMax) {
+		_items.push_back(item);
+		_xMin.push_back(xMin);
+		_yMin.push_back(yMin);
+		_xMax.push_back(xMax);
+		_yMax.push_back(yMax);
+	}
+
+	//! Remove all entries of the item, like Std::list::remove()
+	void remove(const Item *item) {
+		for (uint i = _items.size(); i-- > 0;) {
+			if (_items[i] == item) {
+				_items.remove_at(i);
+				_xMin.remove_at(i);
+				_yMin.remove_at(i);
+				_xMax.remove_at(i);
+				_yMax.remove_at(i);
+			}
+		}
+	}
+
+	//! Replace the rectangle of the item.
+	//! \return false if the item isn't in this chunk
+	bool update(const Item *item, int32 xMin, int32 yMin, int32 xMax, int32 yMax) {
+		for (uint i = 0; i < _items.size(); i++) {
+			if (_items[i] == item) {
+				_xMin[i] = xMin;
+				_yMin[i] = yMin;
+				_xMax[i] = xMax;
+				_yMax[i] = yMax;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//! Test the rectangles from index start on against the open rectangle
+	//! (xMin, yMin)-(xMax, yMax). Sets hits[i] for the rectangles at
+	//! start + i which overlap it.
+	//! \return the number of rectangles tested, at most kBlockSize
+	uint overlaps(uint start, int32 xMin, int32 yMin, int32 xMax, int32 yMax, uint8 *hits) const {
+		const uint count = MIN<uint>(_items.size() - start, kBlockSize);
+		const int32 *x0 = _xMin.data() + start;
+		const int32 *y0 = _yMin.data() + start;
+		const int32 *x1 = _xMax.data() + start;
+		const int32 *y1 = _yMax.data() + start;
+
+		// No early outs, so the compiler can vectorize this
+		for (uint i = 0; i < count; i++) {
+			hits[i] = (x0[i] < xMax) & (x1[i] > xMin) & (y0[i] < yMax) & (y1[i] > yMin);
+		}
+		return count;
+	}
+
+private:
+	Common::Array<Item *> _items;
+	Common::Array<int32> _xMin;
+	Common::Array<int32> _yMin;
+	Common::Array<int32> _xMax;
+	Common::Array<int32> _yMax;
+};
+
+} // End of namespace Ultima8
+} // End of namespace Ultima
+
+#endif
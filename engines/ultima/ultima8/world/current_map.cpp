@@ -48,7 +48,72 @@ typedef Std::list<Item *> item_list;
 
 static const int INT_MAX_VALUE = 0x7fffffff;
 
-CurrentMap::CurrentMap() : _currentMap(0), _eggHatcher(0),
+// The search rectangle of an item. The footpad is widened to the larger of
+// its x and y size, so the rectangle contains the item whether it is
+// flipped or not.
+static inline void getItemBox(const Item *item, int32 &xMin, int32 &yMin, int32 &xMax, int32 &yMax) {
+	int32 ix, iy, iz, ixd, iyd, izd;
+	item->getLocation(ix, iy, iz);
+	item->getShapeInfo()->getFootpadWorld(ixd, iyd, izd, 0);
+
+	int32 d = MAX(ixd, iyd);
+	xMin = ix - d;
+	yMin = iy - d;
+	xMax = ix;
+	yMax = iy;
+}
+
+/**
+ * Walks the items of one chunk that a search has to look at, in item list
+ * order: those whose rectangle overlaps the search area, or every item in
+ * the chunk's item list when the rectangles are disabled.
+ */
+class ChunkItemSearch {
+public:
+	ChunkItemSearch(const item_list &items, const ChunkItemBoxes &boxes, bool useBoxes,
+	                int32 xMin, int32 yMin, int32 xMax, int32 yMax) :
+		_items(items), _iter(items.begin()), _boxes(boxes), _useBoxes(useBoxes),
+		_xMin(xMin), _yMin(yMin), _xMax(xMax), _yMax(yMax),
+		_block(0), _count(0), _next(0) {
+	}
+
+	//! \return the next item, or nullptr when the chunk is done
+	const Item *next() {
+		if (!_useBoxes) {
+			if (_iter == _items.end())
+				return nullptr;
+			return *_iter++;
+		}
+
+		for (;;) {
+			while (_next < _count) {
+				uint b = _next++;
+				if (_hits[b])
+					return _boxes.getItem(_block + b);
+			}
+
+			_block += _count;
+			if (_block >= _boxes.size())
+				return nullptr;
+			_count = _boxes.overlaps(_block, _xMin, _yMin, _xMax, _yMax, _hits);
+			_next = 0;
+		}
+	}
+
+private:
+	const item_list &_items;
+	item_list::const_iterator _iter;
+	const ChunkItemBoxes &_boxes;
+	const bool _useBoxes;
+	const int32 _xMin, _yMin, _xMax, _yMax;
+
+	uint _block;
+	uint _count;
+	uint _next;
+	uint8 _hits[ChunkItemBoxes::kBlockSize];
+};
+
+CurrentMap::CurrentMap() : _currentMap(0), _eggHatcher(0), _itemBoxesEnabled(true),
 	  _fastXMin(-1), _fastYMin(-1), _fastXMax(-1), _fastYMax(-1) {
 	for (unsigned int i = 0; i < MAP_NUM_CHUNKS; i++) {
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
@@ -79,6 +144,7 @@ void CurrentMap::clear() {
 			for (iter = _items[i][j].begin(); iter != _items[i][j].end(); ++iter)
 				delete *iter;
 			_items[i][j].clear();
+			_itemBoxes[i][j].clear();
 		}
 		memset(_fast[i], false, sizeof(uint32)*MAP_NUM_CHUNKS / 32);
 	}
@@ -147,6 +213,7 @@ void CurrentMap::writeback() {
 				}
 			}
 			_items[i][j].clear();
+			_itemBoxes[i][j].clear();
 		}
 	}
 
@@ -254,6 +321,10 @@ void CurrentMap::addItem(Item *item) {
 	_items[cx][cy].push_front(item);
 	item->setExtFlag(Item::EXT_INCURMAP);
 
+	int32 xMin, yMin, xMax, yMax;
+	getItemBox(item, xMin, yMin, xMax, yMax);
+	_itemBoxes[cx][cy].pushFront(item, xMin, yMin, xMax, yMax);
+
 	Egg *egg = dynamic_cast<Egg *>(item);
 	if (egg) {
 		EggHatcherProcess *ehp = dynamic_cast<EggHatcherProcess *>(Kernel::get_instance()->getProcess(_eggHatcher));
@@ -294,6 +365,10 @@ void CurrentMap::addItemToEnd(Item *item) {
 	_items[cx][cy].push_back(item);
 	item->setExtFlag(Item::EXT_INCURMAP);
 
+	int32 xMin, yMin, xMax, yMax;
+	getItemBox(item, xMin, yMin, xMax, yMax);
+	_itemBoxes[cx][cy].pushBack(item, xMin, yMin, xMax, yMax);
+
 	Egg *egg = dynamic_cast<Egg *>(item);
 	if (egg) {
 		EggHatcherProcess *ehp = dynamic_cast<EggHatcherProcess *>(Kernel::get_instance()->getProcess(_eggHatcher));
@@ -407,9 +482,30 @@ void CurrentMap::removeItemFromList(Item *item, int32 oldx, int32 oldy) {
 	int32 cy = oldy / _mapChunkSize;
 
 	_items[cx][cy].remove(item);
+	_itemBoxes[cx][cy].remove(item);
 	item->clearExtFlag(Item::EXT_INCURMAP);
 }
 
+void CurrentMap::updateItemBox(const Item *item, int32 oldx, int32 oldy) {
+	int32 xMin, yMin, xMax, yMax;
+	getItemBox(item, xMin, yMin, xMax, yMax);
+
+	if (oldx >= 0 && oldx < _mapChunkSize * MAP_NUM_CHUNKS &&
+	        oldy >= 0 && oldy < _mapChunkSize * MAP_NUM_CHUNKS) {
+		if (_itemBoxes[oldx / _mapChunkSize][oldy / _mapChunkSize].update(item, xMin, yMin, xMax, yMax))
+			return;
+	}
+
+	// The item was moved with setLocation() more than once since it was
+	// added, so it isn't in the chunk of the previous location any more.
+	for (unsigned int i = 0; i < MAP_NUM_CHUNKS; i++) {
+		for (unsigned int j = 0; j < MAP_NUM_CHUNKS; j++) {
+			if (_itemBoxes[i][j].update(item, xMin, yMin, xMax, yMax))
+				return;
+		}
+	}
+}
+
 // Check to see if the chunk is on the screen
 static inline bool ChunkOnScreen(int32 cx, int32 cy, int32 sleft, int32 stop, int32 sright, int32 sbot, int mapChunkSize) {
 	int32 scx = (cx * mapChunkSize - cy * mapChunkSize) / 4;
@@ -584,12 +680,10 @@ void CurrentMap::areaSearch(UCList *itemlist, const uint8 *loopscript,
 	//
 	for (int cy = miny; cy <= maxy; cy++) {
 		for (int cx = minx; cx <= maxx; cx++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
-
-				const Item *item = *iter;
-
+			ChunkItemSearch search(_items[cx][cy], _itemBoxes[cx][cy], _itemBoxesEnabled,
+			                       searchrange.left, searchrange.top, searchrange.right, searchrange.bottom);
+			const Item *item;
+			while ((item = search.next()) != nullptr) {
 				if (item->hasExtFlags(Item::EXT_SPRITE))
 					continue;
 
@@ -649,12 +743,10 @@ void CurrentMap::surfaceSearch(UCList *itemlist, const uint8 *loopscript,
 
 	for (int cy = miny; cy <= maxy; cy++) {
 		for (int cx = minx; cx <= maxx; cx++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
-
-				const Item *item = *iter;
-
+			ChunkItemSearch search(_items[cx][cy], _itemBoxes[cx][cy], _itemBoxesEnabled,
+			                       searchrange.left, searchrange.top, searchrange.right, searchrange.bottom);
+			const Item *item;
+			while ((item = search.next()) != nullptr) {
 				if (item->getObjId() == check)
 					continue;
 				if (item->hasExtFlags(Item::EXT_SPRITE))
@@ -776,10 +868,10 @@ bool CurrentMap::isValidPosition(int32 x, int32 y, int32 z,
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-				 iter != _items[cx][cy].end(); ++iter) {
-				const Item *item = *iter;
+			ChunkItemSearch search(_items[cx][cy], _itemBoxes[cx][cy], _itemBoxesEnabled,
+			                       x - xd, y - yd, x, y);
+			const Item *item;
+			while ((item = search.next()) != nullptr) {
 				if (item->getObjId() == item_)
 					continue;
 				if (item->hasExtFlags(Item::EXT_SPRITE))
@@ -1073,15 +1165,22 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 //	pout << "Sweeping to   (" << vel[0]-ext[0] << ", " << vel[1]-ext[1] << ", " << vel[2]-ext[2] << ")" << Std::endl;
 //	pout << "              (" << vel[0]+ext[0] << ", " << vel[1]+ext[1] << ", " << vel[2]+ext[2] << ")" << Std::endl;
 
+	// Area covered by the whole move. Items outside it (with a margin for
+	// the rounding below) can't be touched.
+	const int32 sweepXMin = MIN(start[0], end[0]) - dims[0] - 2;
+	const int32 sweepYMin = MIN(start[1], end[1]) - dims[1] - 2;
+	const int32 sweepXMax = MAX(start[0], end[0]) + 2;
+	const int32 sweepYMax = MAX(start[1], end[1]) + 2;
+
 	Std::list<SweepItem>::iterator sw_it;
 	if (hit) sw_it = hit->end();
 
 	for (int cx = minx; cx <= maxx; cx++) {
 		for (int cy = miny; cy <= maxy; cy++) {
-			item_list::const_iterator iter;
-			for (iter = _items[cx][cy].begin();
-			        iter != _items[cx][cy].end(); ++iter) {
-				const Item *other_item = *iter;
+			ChunkItemSearch search(_items[cx][cy], _itemBoxes[cx][cy], _itemBoxesEnabled,
+			                       sweepXMin, sweepYMin, sweepXMax, sweepYMax);
+			const Item *other_item;
+			while ((other_item = search.next()) != nullptr) {
 				if (other_item->getObjId() == item)
 					continue;
 				if (other_item->hasExtFlags(Item::EXT_SPRITE))
@@ -1237,11 +1336,11 @@ bool CurrentMap::sweepTest(const int32 start[3], const int32 end[3],
 
 					// Now add it
 					sw_it = hit->insert(sw_it, SweepItem(other_item->getObjId(), first, last, touch, touch_floor, blocking, dirs));
-//					pout << "Hit item " << other_item->getObjId() << " at (" << first << "," << last << ")" << Std::endl;
-//					pout << "hit item      (" << other[0] << ", " << other[1] << ", " << other[2] << ")" << Std::endl;
-//					pout << "hit item time (" << u_0[0] << "-" << u_1[0] << ") (" << u_0[1] << "-" << u_1[1] << ") ("
-//						 << u_0[2] << "-" << u_1[2] << ")" << Std::endl;
-//					pout << "touch: " << touch << ", floor: " << touch_floor << ", block: " << blocking << Std::endl;
+//						pout << "Hit item " << other_item->getObjId() << " at (" << first << "," << last << ")" << Std::endl;
+//						pout << "hit item      (" << other[0] << ", " << other[1] << ", " << other[2] << ")" << Std::endl;
+//						pout << "hit item time (" << u_0[0] << "-" << u_1[0] << ") (" << u_0[1] << "-" << u_1[1] << ") ("
+//							 << u_0[2] << "-" << u_1[2] << ")" << Std::endl;
+//						pout << "touch: " << touch << ", floor: " << touch_floor << ", block: " << blocking << Std::endl;
 				}
 			}
 		}
@@ -25,6 +25,7 @@
 #include "ultima/shared/std/containers.h"
 #include "ultima/ultima8/usecode/intrinsics.h"
 #include "ultima/ultima8/misc/direction.h"
+#include "ultima/ultima8/world/chunk_item_boxes.h"
 
 namespace Ultima {
 namespace Ultima8 {
@@ -70,6 +71,16 @@ public:
 	void removeItemFromList(Item *item, int32 oldx, int32 oldy);
 	void removeItem(Item *item);
 
+	//! Update the search rectangle of an item in the map after its location
+	//! or shape changed. oldx and oldy are its location when it was added.
+	void updateItemBox(const Item *item, int32 oldx, int32 oldy);
+
+	//! Disable the rectangle pre-test in searches. (For benchmarking and
+	//! verifying it.)
+	void setItemBoxesEnabled(bool enabled) {
+		_itemBoxesEnabled = enabled;
+	}
+
 	//! Add an item to the list of possible targets (in Crusader)
 	void addTargetItem(const Item *item);
 	//! Remove an item from the list of possible targets (in Crusader)
@@ -228,6 +239,10 @@ private:
 	// items[x][y]
 	Std::list<Item *> _items[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
 
+	//! Rectangles of the items in _items, in the same order, for searches
+	ChunkItemBoxes _itemBoxes[MAP_NUM_CHUNKS][MAP_NUM_CHUNKS];
+	bool _itemBoxesEnabled;
+
 	ProcId _eggHatcher;
 
 	// Fast area bit masks -> fast[ry][rx/32]&(1<<(rx&31));
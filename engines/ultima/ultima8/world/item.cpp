@@ -146,9 +146,17 @@ Item *Item::getTopItem() {
 }
 
 void Item::setLocation(int32 X, int32 Y, int32 Z) {
+	int32 oldX = _x;
+	int32 oldY = _y;
+
 	_x = X;
 	_y = Y;
 	_z = Z;
+
+	// The map doesn't move the item to another chunk, but its search
+	// rectangle has to follow
+	if (_extendedFlags & EXT_INCURMAP)
+		World::get_instance()->getCurrentMap()->updateItemBox(this, oldX, oldY);
 }
 
 void Item::move(const Point3 &pt) {
@@ -217,6 +225,9 @@ void Item::move(int32 X, int32 Y, int32 Z) {
 			map->addItemToEnd(this);
 		else
 			map->addItem(this);
+	} else {
+		// Moved within the same chunk
+		map->updateItemBox(this, X, Y);
 	}
 
 	// Call just moved
@@ -493,6 +504,10 @@ void Item::setShape(uint32 shape) {
 		_shape = shape;
 		_cachedShapeInfo = nullptr;
 	}
+
+	// The footpad may have changed
+	if (_extendedFlags & EXT_INCURMAP)
+		World::get_instance()->getCurrentMap()->updateItemBox(this, _x, _y);
 }
 
 bool Item::overlaps(const Item &item2) const {
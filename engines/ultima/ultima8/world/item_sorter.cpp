@@ -41,29 +41,62 @@
 namespace Ultima {
 namespace Ultima8 {
 
+// Size (in pixels) of the cells of the screenspace grid
+static const int32 SORT_GRID_CELL_SIZE = 64;
+
+// Orders item indices as the display list is ordered: by z, then in the
+// order they were added.
+struct SortItemListOrder {
+	const Common::Array<SortItem *> &_items;
+
+	SortItemListOrder(const Common::Array<SortItem *> &items) : _items(items) { }
+
+	bool operator()(uint32 a, uint32 b) const {
+		if (_items[a]->ListLessThan(_items[b]))
+			return true;
+		if (_items[b]->ListLessThan(_items[a]))
+			return false;
+		return a < b;
+	}
+};
+
 ItemSorter::ItemSorter() :
 	_shapes(nullptr), _surf(nullptr), _items(nullptr), _itemsTail(nullptr),
-	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0) {
+	_itemsUnused(nullptr), _sortLimit(0), _camSx(0), _camSy(0), _orderCounter(0),
+	_matchedEntries(0), _reusing(false), _listFinished(false), _gridW(0), _gridH(0) {
 	int i = 2048;
 	while (i--) _itemsUnused = new SortItem(_itemsUnused);
 }
 
 ItemSorter::~ItemSorter() {
-	//
-	if (_itemsTail) {
-		_itemsTail->_next = _itemsUnused;
-		_itemsUnused = _items;
-	}
-	_items = nullptr;
-	_itemsTail = nullptr;
+	ResetDisplayList();
 
 	while (_itemsUnused) {
 		SortItem *_next = _itemsUnused->_next;
 		delete _itemsUnused;
 		_itemsUnused = _next;
 	}
+}
 
-	delete [] _items;
+void ItemSorter::ResetDisplayList() {
+	for (uint i = 0; i < _added.size(); i++) {
+		_added[i]->_next = _itemsUnused;
+		_itemsUnused = _added[i];
+	}
+	_added.resize(0);
+	_items = nullptr;
+	_itemsTail = nullptr;
+
+	for (uint i = 0; i < _grid.size(); i++)
+		_grid[i].resize(0);
+}
+
+void ItemSorter::RebuildDisplayList() {
+	_reusing = false;
+	ResetDisplayList();
+	_entries.resize(_matchedEntries);
+	for (uint i = 0; i < _entries.size(); i++)
+		AddSortItem(_entries[i]);
 }
 
 void ItemSorter::BeginDisplayList(RenderSurface *rs,
@@ -71,35 +104,81 @@ void ItemSorter::BeginDisplayList(RenderSurface *rs,
 	// Get the _shapes, if required
 	if (!_shapes) _shapes = GameData::get_instance()->getMainShapes();
 
-	//
-	if (_itemsTail) {
-		_itemsTail->_next = _itemsUnused;
-		_itemsUnused = _items;
-	}
-	_items = nullptr;
-	_itemsTail = nullptr;
+	// Screenspace bounding box bottom x coord (RNB x coord)
+	int32 camSx = (camx - camy) / 4;
+	// Screenspace bounding box bottom extent  (RNB y coord)
+	int32 camSy = (camx + camy) / 8 - camz;
+
+	Rect clipRect;
+	rs->GetClippingRect(clipRect);
+
+	// Only the items which were added can be reused
+	_reusing = _listFinished && rs == _surf && camSx == _camSx &&
+	           camSy == _camSy && clipRect == _gridRect;
+	_matchedEntries = 0;
+	_listFinished = false;
 
 	// Set the RenderSurface, and reset the item list
 	_surf = rs;
 	_orderCounter = 0;
+	_camSx = camSx;
+	_camSy = camSy;
 
-	// Screenspace bounding box bottom x coord (RNB x coord)
-	_camSx = (camx - camy) / 4;
-	// Screenspace bounding box bottom extent  (RNB y coord)
-	_camSy = (camx + camy) / 8 - camz;
+	if (_reusing)
+		return;
+
+	ResetDisplayList();
+	_entries.resize(0);
+
+	if (clipRect != _gridRect) {
+		_gridRect = clipRect;
+		_gridW = MAX<int32>(1, (clipRect.width() + SORT_GRID_CELL_SIZE - 1) / SORT_GRID_CELL_SIZE);
+		_gridH = MAX<int32>(1, (clipRect.height() + SORT_GRID_CELL_SIZE - 1) / SORT_GRID_CELL_SIZE);
+		_grid.resize(_gridW * _gridH);
+	}
 }
 
 void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 frame_num, uint32 flags, uint32 ext_flags, uint16 itemNum) {
+	DisplayListEntry entry;
+	entry._x = x;
+	entry._y = y;
+	entry._z = z;
+	entry._shapeNum = shapeNum;
+	entry._frame = frame_num;
+	entry._flags = flags;
+	entry._extFlags = ext_flags;
+	entry._itemNum = itemNum;
+
+	if (_reusing) {
+		if (_matchedEntries < _entries.size() && _entries[_matchedEntries] == entry) {
+			_matchedEntries++;
+			return;
+		}
+
+		// Something changed, so build the list after all
+		RebuildDisplayList();
+	}
+
+	_entries.push_back(entry);
+	AddSortItem(entry);
+}
+
+void ItemSorter::AddSortItem(const DisplayListEntry &entry) {
+	const int32 x = entry._x;
+	const int32 y = entry._y;
+	const int32 z = entry._z;
+	const uint32 shapeNum = entry._shapeNum;
+	const uint32 flags = entry._flags;
 
 	// First thing, get a SortItem to use (first of unused)
 	if (!_itemsUnused)
 		_itemsUnused = new SortItem(0);
 	SortItem *si = _itemsUnused;
 
-	si->_itemNum = itemNum;
+	si->_itemNum = entry._itemNum;
 	si->_shape = _shapes->getShape(shapeNum);
 	si->_shapeNum = shapeNum;
-	si->_frame = frame_num;
+	si->_frame = entry._frame;
 	const ShapeFrame *_frame = si->_shape ? si->_shape->getFrame(si->_frame) : nullptr;
 	if (!_frame) {
 		perr << "Invalid shape: " << si->_shapeNum << "," << si->_frame << Std::endl;
@@ -107,7 +186,7 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 	}
 
 	si->_flags = flags;
-	si->_extFlags = ext_flags;
+	si->_extFlags = entry._extFlags;
 
 	const ShapeInfo *info = _shapes->getShapeInfo(shapeNum);
 	// Dimensions
@@ -178,14 +257,30 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
+	// Only the items in the grid cells covered by our screenspace bounding
+	// box can overlap us. They are compared in display list order, since
+	// an item can be found occluded part way through.
+	int32 cx0 = CLIP<int32>((si->_sxLeft - _gridRect.left) / SORT_GRID_CELL_SIZE, 0, _gridW - 1);
+	int32 cx1 = CLIP<int32>((si->_sxRight - _gridRect.left) / SORT_GRID_CELL_SIZE, 0, _gridW - 1);
+	int32 cy0 = CLIP<int32>((si->_syTop - _gridRect.top) / SORT_GRID_CELL_SIZE, 0, _gridH - 1);
+	int32 cy1 = CLIP<int32>((si->_syBot - _gridRect.top) / SORT_GRID_CELL_SIZE, 0, _gridH - 1);
+
+	_candidates.resize(0);
+	for (int32 cy = cy0; cy <= cy1; cy++) {
+		for (int32 cx = cx0; cx <= cx1; cx++) {
+			const Common::Array<uint32> &cell = _grid[cy * _gridW + cx];
+			for (uint i = 0; i < cell.size(); i++)
+				_candidates.push_back(cell[i]);
+		}
+	}
+	Common::sort(_candidates.begin(), _candidates.end(), SortItemListOrder(_added));
 
-	// Ok,
-	SortItem *addpoint = nullptr;
-	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
-		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->ListLessThan(si2))
-			addpoint = si2;
+	for (uint i = 0; i < _candidates.size(); i++) {
+		// Items spanning several cells are found more than once
+		if (i > 0 && _candidates[i] == _candidates[i - 1])
+			continue;
+
+		SortItem *si2 = _added[_candidates[i]];
 
 		// Doesn't overlap
 		if (si2->_occluded || !si->overlap(*si2))
@@ -212,28 +307,51 @@ void ItemSorter::AddItem(int32 x, int32 y, int32 z, uint32 shapeNum, uint32 fram
 		}
 	}
 
-	// Add it to the list
+	// Add it to the list. Occluded items are skipped by everything else,
+	// so they don't need to be in the grid.
 	_itemsUnused = _itemsUnused->_next;
+	if (!si->_occluded) {
+		for (int32 cy = cy0; cy <= cy1; cy++) {
+			for (int32 cx = cx0; cx <= cx1; cx++)
+				_grid[cy * _gridW + cx].push_back(_added.size());
+		}
+	}
+	_added.push_back(si);
+}
 
-	// have a position
-	//addpoint = 0;
-	if (addpoint) {
-		si->_next = addpoint;
-		si->_prev = addpoint->_prev;
-		addpoint->_prev = si;
-		if (si->_prev)
-			si->_prev->_next = si;
-		else
-			_items = si;
+void ItemSorter::FinishDisplayList() {
+	if (_listFinished)
+		return;
+	_listFinished = true;
+
+	if (_reusing) {
+		if (_matchedEntries == _entries.size()) {
+			// Same items as last time, only the painting order needs a reset
+			for (SortItem *si = _items; si != nullptr; si = si->_next)
+				si->_order = -1;
+			return;
+		}
+
+		// Some items went away, so build the list after all
+		RebuildDisplayList();
 	}
-	// Add it to the end of the list
-	else {
+
+	// Link the items sorted by z, keeping the order they were added in
+	_candidates.resize(_added.size());
+	for (uint i = 0; i < _added.size(); i++)
+		_candidates[i] = i;
+	Common::sort(_candidates.begin(), _candidates.end(), SortItemListOrder(_added));
+
+	_items = nullptr;
+	_itemsTail = nullptr;
+	for (uint i = 0; i < _candidates.size(); i++) {
+		SortItem *si = _added[_candidates[i]];
+		si->_prev = _itemsTail;
+		si->_next = nullptr;
 		if (_itemsTail)
 			_itemsTail->_next = si;
-		if (!_items)
+		else
 			_items = si;
-		si->_next = nullptr;
-		si->_prev = _itemsTail;
 		_itemsTail = si;
 	}
 }
@@ -248,6 +366,8 @@ void ItemSorter::AddItem(const Item *add) {
 SortItem *_prev = 0;
 
 void ItemSorter::PaintDisplayList(bool item_highlight) {
+	FinishDisplayList();
+
 	_prev = nullptr;
 	SortItem *it = _items;
 	SortItem *end = nullptr;
@@ -393,6 +513,8 @@ uint16 ItemSorter::Trace(int32 x, int32 y, HitFace *face, bool item_highlight) {
 	SortItem *it;
 	SortItem *selected;
 
+	FinishDisplayList();
+
 	if (!_orderCounter) { // If no _orderCounter we need to sort the _items
 		it = _items;
 		_orderCounter = 0;  // Reset the _orderCounter
@@ -22,6 +22,9 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "common/array.h"
+#include "ultima/ultima8/misc/rect.h"
+
 namespace Ultima {
 namespace Ultima8 {
 
@@ -43,6 +46,39 @@ class ItemSorter {
 
 	int32       _camSx, _camSy;
 
+	// The arguments of an AddItem call
+	struct DisplayListEntry {
+		int32 _x, _y, _z;
+		uint32 _shapeNum, _frame, _flags, _extFlags;
+		uint16 _itemNum;
+
+		bool operator==(const DisplayListEntry &o) const {
+			return _x == o._x && _y == o._y && _z == o._z &&
+			       _shapeNum == o._shapeNum && _frame == o._frame &&
+			       _flags == o._flags && _extFlags == o._extFlags &&
+			       _itemNum == o._itemNum;
+		}
+	};
+
+	// AddItem calls of the current list. If a frame makes exactly the same
+	// calls as the previous one with the same camera, the previous sorted
+	// list and its dependencies are reused.
+	Common::Array<DisplayListEntry> _entries;
+	uint32      _matchedEntries;
+	bool        _reusing;
+	bool        _listFinished;
+
+	// Items in the order they were added
+	Common::Array<SortItem *> _added;
+
+	// Screenspace grid of the (indices of the) items overlapping each cell,
+	// so items only need to be compared with the items near them
+	Common::Array<Common::Array<uint32> > _grid;
+	Rect        _gridRect;
+	int32       _gridW, _gridH;
+
+	Common::Array<uint32> _candidates;
+
 public:
 	ItemSorter();
 	~ItemSorter();
@@ -67,6 +103,10 @@ public:
 	void IncSortLimit(int count);
 
 private:
+	void AddSortItem(const DisplayListEntry &entry);
+	void ResetDisplayList();
+	void RebuildDisplayList();
+	void FinishDisplayList();
 	bool PaintSortItem(SortItem *);
 	bool NullPaintSortItem(SortItem *);
 };
@@ -1591,6 +1591,10 @@ bool AdGame::scheduleChangeScene(const char *filename, bool fadeIn) {
 		_scheduledScene = new char [strlen(filename) + 1];
 		strcpy(_scheduledScene, filename);
 
+		// The scene is loaded once the current one has faded out, so start
+		// reading its definition in the meantime
+		BaseFileManager::getEngineInstance()->prefetchFile(filename);
+
 		_scheduledFadeIn = fadeIn;
 
 		return STATUS_OK;
@@ -2165,6 +2169,30 @@ bool AdGame::displayContent(bool doUpdate, bool displayAll) {
 	return STATUS_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool AdGame::updateContent() {
+	// the update parts of displayContent(), in the same order
+	initLoop();
+
+	if (_videoPlayer->isPlaying()) {
+		_videoPlayer->update();
+	} else if (_theoraPlayer) {
+		if (_theoraPlayer->isPlaying()) {
+			_theoraPlayer->update();
+		}
+		if (_theoraPlayer->isFinished()) {
+			delete _theoraPlayer;
+			_theoraPlayer = nullptr;
+		}
+	} else {
+		_scEngine->tick();
+		_scene->update();
+		_transMgr->update();
+	}
+
+	return STATUS_OK;
+}
+
 //////////////////////////////////////////////////////////////////////////
 bool AdGame::registerInventory(AdInventory *inv) {
 	for (uint32 i = 0; i < _inventories.size(); i++) {
@@ -72,6 +72,7 @@ public:
 	bool registerInventory(AdInventory *inv);
 	bool unregisterInventory(AdInventory *inv);
 	bool displayContent(bool update = true, bool displayAll = false) override;
+	bool updateContent() override;
 
 	bool gameResponseUsed(int ID) const;
 	bool addGameResponse(int ID);
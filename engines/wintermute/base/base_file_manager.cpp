@@ -80,6 +80,12 @@ bool BaseFileManager::cleanup() {
 	}
 	_openFiles.clear();
 
+	// drop the files loaded ahead, and those still queued
+	if (!_prefetchedFiles.empty()) {
+		ArchiveReadMan.cancelAll(&_packages);
+		_prefetchedFiles.clear();
+	}
+
 	// delete packages
 	_packages.clear();
 
@@ -347,10 +353,9 @@ void BaseFileManager::initResources() {
 }
 
 //////////////////////////////////////////////////////////////////////////
-Common::SeekableReadStream *BaseFileManager::openPkgFile(const Common::String &filename) {
+Common::String BaseFileManager::getPackageMemberName(const Common::String &filename) {
 	Common::String upcName = filename;
 	upcName.toUppercase();
-	Common::SeekableReadStream *file = nullptr;
 
 	// correct slashes
 	for (uint32 i = 0; i < upcName.size(); i++) {
@@ -358,6 +363,35 @@ Common::SeekableReadStream *BaseFileManager::openPkgFile(const Common::String &f
 			upcName.setChar('\\', (uint32)i);
 		}
 	}
+	return upcName;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void BaseFileManager::prefetchFile(const Common::String &filename) {
+	Common::String upcName = getPackageMemberName(filename);
+	if (_detectionMode || _prefetchedFiles.contains(upcName) || !_packages.hasFile(upcName)) {
+		return;
+	}
+
+	debugC(kWintermuteDebugFileAccess, "Prefetch file %s", filename.c_str());
+	_prefetchedFiles[upcName] = ArchiveReadMan.submit(&_packages, upcName);
+}
+
+//////////////////////////////////////////////////////////////////////////
+Common::SeekableReadStream *BaseFileManager::openPkgFile(const Common::String &filename) {
+	Common::String upcName = getPackageMemberName(filename);
+	Common::SeekableReadStream *file = nullptr;
+
+	// a file loaded ahead is handed out once, later opens read the package again
+	Common::HashMap<Common::String, Common::ArchiveReadRequestPtr>::iterator prefetched = _prefetchedFiles.find(upcName);
+	if (prefetched != _prefetchedFiles.end()) {
+		file = ArchiveReadMan.takeStream(prefetched->_value);
+		_prefetchedFiles.erase(prefetched);
+		if (file) {
+			return file;
+		}
+	}
+
 	Common::ArchiveMemberPtr entry = _packages.getMember(upcName);
 	if (!entry) {
 		return nullptr;
@@ -29,6 +29,8 @@
 #define WINTERMUTE_BASE_FILE_MANAGER_H
 
 #include "common/archive.h"
+#include "common/archive-readqueue.h"
+#include "common/hashmap.h"
 #include "common/str.h"
 #include "common/str-array.h"
 #include "common/fs.h"
@@ -47,6 +49,8 @@ public:
 	Common::SeekableReadStream *openFile(const Common::String &filename, bool absPathWarning = true, bool keepTrackOf = true);
 	Common::WriteStream *openFileForWrite(const Common::String &filename);
 	byte *readWholeFile(const Common::String &filename, uint32 *size = nullptr, bool mustExist = true);
+	// Queue loading a packaged file that is going to be opened soon
+	void prefetchFile(const Common::String &filename);
 	uint32 getPackageVersion(const Common::String &filename);
 
 	BaseFileManager(Common::Language lang, bool detectionMode = false);
@@ -67,10 +71,12 @@ private:
 	Common::SeekableReadStream *openFileRaw(const Common::String &filename);
 	Common::WriteStream *openFileForWriteRaw(const Common::String &filename);
 	Common::SeekableReadStream *openPkgFile(const Common::String &filename);
+	static Common::String getPackageMemberName(const Common::String &filename);
 	Common::FSList _packagePaths;
 	bool registerPackage(Common::FSNode package, const Common::String &filename = "", bool searchSignature = false);
 	bool _detectionMode;
 	Common::SearchSet _packages;
+	Common::HashMap<Common::String, Common::ArchiveReadRequestPtr> _prefetchedFiles;
 	Common::Array<Common::SeekableReadStream *> _openFiles;
 	Common::Language _language;
 	Common::Archive *_resources;
@@ -4251,6 +4251,11 @@ bool BaseGame::displayContent(bool doUpdate, bool displayAll) {
 	return STATUS_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////
+bool BaseGame::updateContent() {
+	return STATUS_OK;
+}
+
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseGame::displayContentSimple() {
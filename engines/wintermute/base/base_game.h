@@ -266,6 +266,8 @@ public:
 	bool displayQuickMsg();
 
 	virtual bool displayContent(bool update = true, bool displayAll = false);
+	// Runs the game logic of a frame without drawing anything
+	virtual bool updateContent();
 	virtual bool displayContentSimple();
 	bool _forceNonStreamedSounds;
 	void resetMousePos();
@@ -137,6 +137,15 @@ public:
 	virtual bool displayDebugInfo() {
 		return STATUS_FAILED;
 	};
+	/**
+	 * Get a summary of how much drawing the last frames took, for the debugger.
+	 *
+	 * @return a printable report, or an empty string if the renderer doesn't keep one.
+	 */
+	virtual Common::String getDrawStats() const {
+		return Common::String();
+	}
+	virtual void resetDrawStats() {}
 	virtual bool drawShaderQuad() {
 		return STATUS_FAILED;
 	}
@@ -51,7 +51,7 @@ BaseRenderer *makeOSystemRenderer(BaseGame *inGame) {
 BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_renderSurface = new Graphics::Surface();
 	_blankSurface = new Graphics::Surface();
-	_lastFrameIter = _renderQueue.end();
+	_lastFrameIndex = -1;
 	_needsFlip = true;
 	_skipThisFrame = false;
 
@@ -64,16 +64,16 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	}
 
 	_lastScreenChangeID = g_system->getScreenChangeID();
+
+	resetDrawStats();
 }
 
 //////////////////////////////////////////////////////////////////////////
 BaseRenderOSystem::~BaseRenderOSystem() {
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		delete _renderQueue[i];
 	}
+	_renderQueue.clear();
 
 	delete _dirtyRect;
 
@@ -164,10 +164,9 @@ bool BaseRenderOSystem::flip() {
 		_needsFlip = false;
 
 		// Reset ticketing state
-		_lastFrameIter = _renderQueue.end();
-		RenderQueueIterator it;
-		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-			(*it)->_wantsDraw = false;
+		_lastFrameIndex = -1;
+		for (uint i = 0; i < _renderQueue.size(); i++) {
+			_renderQueue[i]->_wantsDraw = false;
 		}
 
 		addDirtyRect(_renderRect);
@@ -177,17 +176,17 @@ bool BaseRenderOSystem::flip() {
 		drawTickets();
 	} else {
 		// Clear the scale-buffered tickets that wasn't reused.
-		RenderQueueIterator it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			if ((*it)->_wantsDraw == false) {
-				RenderTicket *ticket = *it;
-				it = _renderQueue.erase(it);
+		uint kept = 0;
+		for (uint i = 0; i < _renderQueue.size(); i++) {
+			RenderTicket *ticket = _renderQueue[i];
+			if (ticket->_wantsDraw == false) {
 				delete ticket;
 			} else {
-				(*it)->_wantsDraw = false;
-				++it;
+				ticket->_wantsDraw = false;
+				_renderQueue[kept++] = ticket;
 			}
 		}
+		_renderQueue.resize(kept);
 	}
 
 	int oldScreenChangeID = _lastScreenChangeID;
@@ -203,7 +202,7 @@ bool BaseRenderOSystem::flip() {
 		_dirtyRect = nullptr;
 		_needsFlip = false;
 	}
-	_lastFrameIter = _renderQueue.end();
+	_lastFrameIndex = -1;
 
 	g_system->updateScreen();
 
@@ -302,19 +301,17 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
+		// Avoid calling size() every time, when potentially going through
 		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
+		uint queueSize = _renderQueue.size();
 		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
+		for (uint i = _lastFrameIndex + 1; i < queueSize; i++) {
+			compareTicket = _renderQueue[i];
 			if (*(compareTicket) == compare && compareTicket->_isValid) {
 				if (_disableDirtyRects) {
 					drawFromSurface(compareTicket);
 				} else {
-					drawFromQueuedTicket(it);
+					drawFromQueuedTicket(i);
 				}
 				return;
 			}
@@ -337,10 +334,9 @@ void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 }
 
 void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
-	RenderQueueIterator it;
-	for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
-		if ((*it)->_owner == surf) {
-			invalidateTicket(*it);
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		if (_renderQueue[i]->_owner == surf) {
+			invalidateTicket(_renderQueue[i]);
 		}
 	}
 }
@@ -348,34 +344,30 @@ void BaseRenderOSystem::invalidateTicketsFromSurface(BaseSurfaceOSystem *surf) {
 void BaseRenderOSystem::drawFromTicket(RenderTicket *renderTicket) {
 	renderTicket->_wantsDraw = true;
 
-	++_lastFrameIter;
+	++_lastFrameIndex;
 	// In-order
-	if (_renderQueue.empty() || _lastFrameIter == _renderQueue.end()) {
-		_lastFrameIter--;
+	if ((uint)_lastFrameIndex == _renderQueue.size()) {
 		_renderQueue.push_back(renderTicket);
-		++_lastFrameIter;
 		addDirtyRect(renderTicket->_dstRect);
 	} else {
 		// Before something
-		RenderQueueIterator pos = _lastFrameIter;
-		_renderQueue.insert(pos, renderTicket);
-		--_lastFrameIter;
+		_renderQueue.insert_at(_lastFrameIndex, renderTicket);
 		addDirtyRect(renderTicket->_dstRect);
 	}
 }
 
-void BaseRenderOSystem::drawFromQueuedTicket(const RenderQueueIterator &ticket) {
-	RenderTicket *renderTicket = *ticket;
+void BaseRenderOSystem::drawFromQueuedTicket(uint index) {
+	RenderTicket *renderTicket = _renderQueue[index];
 	assert(!renderTicket->_wantsDraw);
 	renderTicket->_wantsDraw = true;
 
-	++_lastFrameIter;
+	++_lastFrameIndex;
 	// Not in the same order?
-	if (*_lastFrameIter != renderTicket) {
-		--_lastFrameIter;
-		// Remove the ticket from the list
-		assert(*_lastFrameIter != renderTicket);
-		_renderQueue.erase(ticket);
+	if (_renderQueue[_lastFrameIndex] != renderTicket) {
+		--_lastFrameIndex;
+		// Remove the ticket from the queue, it always sits after _lastFrameIndex
+		assert((int)index > _lastFrameIndex);
+		_renderQueue.remove_at(index);
 		// Is not in order, so readd it as if it was a new ticket
 		drawFromTicket(renderTicket);
 	}
@@ -391,50 +383,51 @@ void BaseRenderOSystem::addDirtyRect(const Common::Rect &rect) {
 }
 
 void BaseRenderOSystem::drawTickets() {
-	RenderQueueIterator it = _renderQueue.begin();
 	// Clean out the old tickets
 	// Note: We draw invalid tickets too, otherwise we wouldn't be honoring
 	// the draw request they obviously made BEFORE becoming invalid, either way
 	// we have a copy of their data, so their invalidness won't affect us.
-	while (it != _renderQueue.end()) {
-		if ((*it)->_wantsDraw == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
+	uint kept = 0;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
+		if (ticket->_wantsDraw == false) {
+			addDirtyRect(ticket->_dstRect);
 			delete ticket;
 		} else {
-			++it;
+			_renderQueue[kept++] = ticket;
 		}
 	}
+	_renderQueue.resize(kept);
+
+	memset(&_lastFrameStats, 0, sizeof(_lastFrameStats));
+	_lastFrameStats.frames = 1;
+	_totalStats.frames++;
+
 	if (!_dirtyRect || _dirtyRect->width() == 0 || _dirtyRect->height() == 0) {
-		it = _renderQueue.begin();
-		while (it != _renderQueue.end()) {
-			RenderTicket *ticket = *it;
-			ticket->_wantsDraw = false;
-			++it;
+		for (uint i = 0; i < _renderQueue.size(); i++) {
+			_renderQueue[i]->_wantsDraw = false;
 		}
 		return;
 	}
 
-	it = _renderQueue.begin();
-	_lastFrameIter = _renderQueue.end();
-	// A special case: If the screen has one giant OPAQUE rect to be drawn, then we skip filling
-	// the background color. Typical use-case: Fullscreen FMVs.
-	// Caveat: The FPS-counter will invalidate this.
-	if (it != _lastFrameIter && _renderQueue.front() == _renderQueue.back() && (*it)->_transform._alphaDisable == true) {
-		// If our single opaque rect fills the dirty rect, we can skip filling.
-		if (*_dirtyRect != (*it)->_dstRect) {
-			// Apply the clear-color to the dirty rect.
-			_renderSurface->fillRect(*_dirtyRect, _clearColor);
-		}
-		// Otherwise Do NOT fill.
+	_lastFrameIndex = -1;
+	_lastFrameStats.dirtyPixels = (uint64)_dirtyRect->width() * _dirtyRect->height();
+
+	// If the opaque parts of the tickets cover the whole dirty rect, we can skip
+	// filling the background color. Typical use-case: Fullscreen FMVs and
+	// opaque room backgrounds.
+	if (cullOccludedTickets()) {
+		_lastFrameStats.clearsSkipped = 1;
 	} else {
 		// Apply the clear-color to the dirty rect.
 		_renderSurface->fillRect(*_dirtyRect, _clearColor);
+		_lastFrameStats.drawnPixels += _lastFrameStats.dirtyPixels;
 	}
-	for (; it != _renderQueue.end(); ++it) {
-		RenderTicket *ticket = *it;
-		if (ticket->_dstRect.intersects(*_dirtyRect)) {
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
+		if (ticket->_isOccluded) {
+			_lastFrameStats.ticketsCulled++;
+		} else if (ticket->_dstRect.intersects(*_dirtyRect)) {
 			// dstClip is the area we want redrawn.
 			Common::Rect dstClip(ticket->_dstRect);
 			// reduce it to the dirty rect
@@ -448,25 +441,115 @@ void BaseRenderOSystem::drawTickets() {
 
 			drawFromSurface(ticket, &pos, &dstClip);
 			_needsFlip = true;
+			_lastFrameStats.ticketsDrawn++;
+			_lastFrameStats.drawnPixels += (uint64)pos.width() * pos.height();
 		}
 		// Some tickets want redraw but don't actually clip the dirty area (typically the ones that shouldnt become clear-color)
 		ticket->_wantsDraw = false;
+		ticket->_isOccluded = false;
 	}
 	g_system->copyRectToScreen((byte *)_renderSurface->getBasePtr(_dirtyRect->left, _dirtyRect->top), _renderSurface->pitch, _dirtyRect->left, _dirtyRect->top, _dirtyRect->width(), _dirtyRect->height());
 
-	it = _renderQueue.begin();
+	_totalStats.dirtyPixels += _lastFrameStats.dirtyPixels;
+	_totalStats.drawnPixels += _lastFrameStats.drawnPixels;
+	_totalStats.ticketsDrawn += _lastFrameStats.ticketsDrawn;
+	_totalStats.ticketsCulled += _lastFrameStats.ticketsCulled;
+	_totalStats.clearsSkipped += _lastFrameStats.clearsSkipped;
+
 	// Clean out the old tickets
-	while (it != _renderQueue.end()) {
-		if ((*it)->_isValid == false) {
-			RenderTicket *ticket = *it;
-			addDirtyRect((*it)->_dstRect);
-			it = _renderQueue.erase(it);
+	kept = 0;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		RenderTicket *ticket = _renderQueue[i];
+		if (ticket->_isValid == false) {
+			addDirtyRect(ticket->_dstRect);
 			delete ticket;
 		} else {
-			++it;
+			_renderQueue[kept++] = ticket;
+		}
+	}
+	_renderQueue.resize(kept);
+}
+
+bool BaseRenderOSystem::cullOccludedTickets() {
+	// Only the few largest occluders are tracked, which catches the common
+	// cases (backgrounds, opaque UI panels, FMVs) without going quadratic.
+	const int kMaxOccluders = 4;
+	Common::Rect occluders[kMaxOccluders];
+	int numOccluders = 0;
+
+	// Walk back to front: a ticket is hidden if its visible part lies within
+	// the opaque part of some ticket that is drawn after it.
+	for (int i = (int)_renderQueue.size() - 1; i >= 0; i--) {
+		RenderTicket *ticket = _renderQueue[i];
+		if (!ticket->_dstRect.intersects(*_dirtyRect)) {
+			continue;
+		}
+		Common::Rect visible(ticket->_dstRect);
+		visible.clip(*_dirtyRect);
+
+		bool occluded = false;
+		for (int j = 0; j < numOccluders && !occluded; j++) {
+			occluded = occluders[j].contains(visible);
+		}
+		if (occluded) {
+			ticket->_isOccluded = true;
+			continue;
+		}
+
+		if (ticket->_opaqueRect.isEmpty() || !ticket->_opaqueRect.intersects(*_dirtyRect)) {
+			continue;
+		}
+		Common::Rect opaque(ticket->_opaqueRect);
+		opaque.clip(*_dirtyRect);
+		int area = opaque.width() * opaque.height();
+
+		if (numOccluders < kMaxOccluders) {
+			occluders[numOccluders++] = opaque;
+		} else {
+			// Replace the smallest occluder if this one is bigger
+			int smallest = 0;
+			for (int j = 1; j < kMaxOccluders; j++) {
+				if (occluders[j].width() * occluders[j].height() < occluders[smallest].width() * occluders[smallest].height()) {
+					smallest = j;
+				}
+			}
+			if (area > occluders[smallest].width() * occluders[smallest].height()) {
+				occluders[smallest] = opaque;
+			}
+		}
+	}
+
+	for (int j = 0; j < numOccluders; j++) {
+		if (occluders[j].contains(*_dirtyRect)) {
+			return true;
 		}
 	}
+	return false;
+}
+
+Common::String BaseRenderOSystem::getDrawStats() const {
+	if (_disableDirtyRects) {
+		return "Dirty rects are disabled, every ticket is drawn in full\n";
+	}
+
+	const DrawStats &last = _lastFrameStats;
+	const DrawStats &total = _totalStats;
+	Common::String result;
+	result += Common::String::format("Last frame: %u tickets drawn, %u culled, clear %s\n",
+	                                 last.ticketsDrawn, last.ticketsCulled, last.clearsSkipped ? "skipped" : "done");
+	result += Common::String::format("  dirty %u px, drawn %u px, overdraw %.2fx\n",
+	                                 (uint)last.dirtyPixels, (uint)last.drawnPixels,
+	                                 last.dirtyPixels ? (double)last.drawnPixels / last.dirtyPixels : 0.0);
+	result += Common::String::format("Since reset: %u frames, %u tickets drawn, %u culled, %u clears skipped\n",
+	                                 total.frames, total.ticketsDrawn, total.ticketsCulled, total.clearsSkipped);
+	result += Common::String::format("  average overdraw %.2fx\n",
+	                                 total.dirtyPixels ? (double)total.drawnPixels / total.dirtyPixels : 0.0);
+	return result;
+}
 
+void BaseRenderOSystem::resetDrawStats() {
+	memset(&_lastFrameStats, 0, sizeof(_lastFrameStats));
+	memset(&_totalStats, 0, sizeof(_totalStats));
 }
 
 // Replacement for SDL2's SDL_RenderCopy
@@ -582,16 +665,14 @@ void BaseRenderOSystem::endSaveLoad() {
 	BaseRenderer::endSaveLoad();
 
 	// Clear the scale-buffered tickets as we just loaded.
-	RenderQueueIterator it = _renderQueue.begin();
-	while (it != _renderQueue.end()) {
-		RenderTicket *ticket = *it;
-		it = _renderQueue.erase(it);
-		delete ticket;
+	for (uint i = 0; i < _renderQueue.size(); i++) {
+		delete _renderQueue[i];
 	}
+	_renderQueue.clear();
 	// HACK: After a save the buffer will be drawn before the scripts get to update it,
 	// so just skip this single frame.
 	_skipThisFrame = true;
-	_lastFrameIter = _renderQueue.end();
+	_lastFrameIndex = -1;
 
 	_renderSurface->fillRect(Common::Rect(0, 0, _renderSurface->w, _renderSurface->h), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
 	g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
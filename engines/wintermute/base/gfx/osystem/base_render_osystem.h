@@ -31,7 +31,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 
 #include "common/rect.h"
-#include "common/list.h"
+#include "common/array.h"
 
 #include "graphics/surface.h"
 #include "graphics/transform_struct.h"
@@ -57,14 +57,15 @@ class RenderTicket;
  * There is also a draw path that draws without tickets, for debugging purposes,
  * as well as to accomodate situations with large enough amounts of draw calls,
  * that there will be too much overhead involved with comparing the generated tickets.
+ *
+ * When redrawing the dirty rect, tickets that are completely hidden behind the
+ * opaque parts of tickets drawn later in the same frame are skipped.
  */
 class BaseRenderOSystem : public BaseRenderer {
 public:
 	BaseRenderOSystem(BaseGame *inGame);
 	~BaseRenderOSystem() override;
 
-	typedef Common::List<RenderTicket *>::iterator RenderQueueIterator;
-
 	Common::String getName() const override;
 
 	bool initRenderer(int width, int height, bool windowed) override;
@@ -92,9 +93,9 @@ public:
 	/**
 	 * Re-insert an existing ticket into the queue, adding a dirty rect
 	 * out-of-order from last draw from the ticket.
-	 * @param ticket iterator pointing to the ticket to be added.
+	 * @param index position of the ticket to be added in the queue.
 	 */
-	void drawFromQueuedTicket(const RenderQueueIterator &ticket);
+	void drawFromQueuedTicket(uint index);
 
 	bool setViewport(int left, int top, int right, int bottom) override;
 	bool setViewport(Rect32 *rect) override { return BaseRenderer::setViewport(rect); }
@@ -116,6 +117,8 @@ public:
 	void endSaveLoad() override;
 	void drawSurface(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRect, Graphics::TransformStruct &transform);
 	BaseSurface *createSurface() override;
+	Common::String getDrawStats() const override;
+	void resetDrawStats() override;
 private:
 	/**
 	 * Mark a specified rect of the screen as dirty.
@@ -126,15 +129,22 @@ private:
 	 * Traverse the tickets that are dirty, and draw them
 	 */
 	void drawTickets();
+	/**
+	 * Mark the tickets that are hidden within the dirty rect by opaque
+	 * tickets drawn after them.
+	 * @return true if the dirty rect is covered entirely, so clearing it can be skipped.
+	 */
+	bool cullOccludedTickets();
 	// Non-dirty-rects:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
 	Common::Rect *_dirtyRect;
-	Common::List<RenderTicket *> _renderQueue;
+	Common::Array<RenderTicket *> _renderQueue;
 
 	bool _needsFlip;
-	RenderQueueIterator _lastFrameIter;
+	// Index of the last ticket matched this frame, -1 if none yet.
+	int _lastFrameIndex;
 	Common::Rect _renderRect;
 	Graphics::Surface *_renderSurface;
 	Graphics::Surface *_blankSurface;
@@ -151,6 +161,17 @@ private:
 
 	bool _skipThisFrame;
 	int _lastScreenChangeID; // previous value of OSystem::getScreenChangeID()
+
+	struct DrawStats {
+		uint32 frames;
+		uint64 dirtyPixels;
+		uint64 drawnPixels;
+		uint32 ticketsDrawn;
+		uint32 ticketsCulled;
+		uint32 clearsSkipped;
+	};
+	DrawStats _lastFrameStats;
+	DrawStats _totalStats;
 };
 
 } // End of namespace Wintermute
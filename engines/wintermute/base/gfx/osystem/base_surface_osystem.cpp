@@ -55,6 +55,7 @@ BaseSurfaceOSystem::BaseSurfaceOSystem(BaseGame *inGame) : BaseSurface(inGame) {
 	_lockPitch = 0;
 	_loaded = false;
 	_rotation = 0;
+	_opaqueSpansValid = false;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -216,6 +217,7 @@ bool BaseSurfaceOSystem::finishLoad() {
 	}
 
 	_loaded = true;
+	invalidateOpaqueSpans();
 
 	return true;
 }
@@ -345,12 +347,14 @@ bool BaseSurfaceOSystem::startPixelOp() {
 	// Any pixel-op makes the caching useless:
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
+	invalidateOpaqueSpans();
 	return STATUS_OK;
 }
 
 //////////////////////////////////////////////////////////////////////////
 bool BaseSurfaceOSystem::endPixelOp() {
 	//SDL_UnlockTexture(_texture);
+	invalidateOpaqueSpans();
 	return STATUS_OK;
 }
 
@@ -472,8 +476,93 @@ bool BaseSurfaceOSystem::putSurface(const Graphics::Surface &surface, bool hasAl
 	}
 	BaseRenderOSystem *renderer = static_cast<BaseRenderOSystem *>(_gameRef->_renderer);
 	renderer->invalidateTicketsFromSurface(this);
+	invalidateOpaqueSpans();
 
 	return STATUS_OK;
 }
 
+//////////////////////////////////////////////////////////////////////////
+void BaseSurfaceOSystem::invalidateOpaqueSpans() {
+	_opaqueSpansValid = false;
+}
+
+//////////////////////////////////////////////////////////////////////////
+void BaseSurfaceOSystem::computeOpaqueSpans() {
+	_opaqueSpans.resize(_surface->h);
+	_opaqueSpansValid = true;
+
+	const Graphics::PixelFormat &format = _surface->format;
+	if (_alphaType == Graphics::ALPHA_OPAQUE) {
+		for (int y = 0; y < _surface->h; y++) {
+			_opaqueSpans[y].left = 0;
+			_opaqueSpans[y].right = _surface->w;
+		}
+		return;
+	}
+
+	for (int y = 0; y < _surface->h; y++) {
+		OpaqueSpan &span = _opaqueSpans[y];
+		span.left = span.right = 0;
+		if (format.bytesPerPixel != 4 || format.aBits() != 8) {
+			continue;
+		}
+
+		const uint32 *row = (const uint32 *)_surface->getBasePtr(0, y);
+		int runStart = -1;
+		for (int x = 0; x <= _surface->w; x++) {
+			bool opaque = x < _surface->w && ((row[x] >> format.aShift) & 0xff) == 0xff;
+			if (opaque) {
+				if (runStart < 0) {
+					runStart = x;
+				}
+			} else if (runStart >= 0) {
+				if (x - runStart > span.right - span.left) {
+					span.left = runStart;
+					span.right = x;
+				}
+				runStart = -1;
+			}
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+Common::Rect BaseSurfaceOSystem::getOpaqueRect(const Common::Rect &srcRect) {
+	if (!_loaded) {
+		finishLoad();
+	}
+	if (!_opaqueSpansValid) {
+		computeOpaqueSpans();
+	}
+
+	Common::Rect area(srcRect);
+	area.clip(Common::Rect(_surface->w, _surface->h));
+	if (area.isEmpty() || area.width() != srcRect.width()) {
+		return Common::Rect();
+	}
+
+	// Find the tallest run of rows whose opaque span covers the whole width.
+	int bestTop = 0, bestBottom = 0;
+	int runTop = -1;
+	for (int y = area.top; y <= area.bottom; y++) {
+		bool covered = y < area.bottom && _opaqueSpans[y].left <= area.left && _opaqueSpans[y].right >= area.right;
+		if (covered) {
+			if (runTop < 0) {
+				runTop = y;
+			}
+		} else if (runTop >= 0) {
+			if (y - runTop > bestBottom - bestTop) {
+				bestTop = runTop;
+				bestBottom = y;
+			}
+			runTop = -1;
+		}
+	}
+
+	if (bestBottom == bestTop) {
+		return Common::Rect();
+	}
+	return Common::Rect(area.left, bestTop, area.right, bestBottom);
+}
+
 } // End of namespace Wintermute
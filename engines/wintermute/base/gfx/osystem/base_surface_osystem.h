@@ -33,6 +33,7 @@
 
 #include "engines/wintermute/base/gfx/base_surface.h"
 
+#include "common/array.h"
 #include "common/list.h"
 
 namespace Wintermute {
@@ -91,12 +92,21 @@ public:
 	}
 
 	Graphics::AlphaType getAlphaType() const { return _alphaType; }
+	/**
+	 * Get the tallest band of rows inside srcRect that are fully opaque
+	 * across the whole width of srcRect, in surface coordinates.
+	 * @param srcRect the part of the surface that is going to be drawn.
+	 * @return the opaque band, or an empty rect if there is none.
+	 */
+	Common::Rect getOpaqueRect(const Common::Rect &srcRect);
 private:
 	Graphics::Surface *_surface;
 	bool _loaded;
 	bool finishLoad();
 	bool drawSprite(int x, int y, Rect32 *rect, Rect32 *newRect, Graphics::TransformStruct transformStruct);
 	void genAlphaMask(Graphics::Surface *surface);
+	void computeOpaqueSpans();
+	void invalidateOpaqueSpans();
 	uint32 getPixelAt(Graphics::Surface *surface, int x, int y);
 
 	uint32 _rotation;
@@ -104,6 +114,16 @@ private:
 	void *_lockPixels;
 	int _lockPitch;
 	byte *_alphaMask;
+
+	// Longest run of fully opaque pixels in each row, computed lazily
+	// the first time a ticket asks for it, and dropped whenever the
+	// pixels change.
+	struct OpaqueSpan {
+		int16 left;
+		int16 right;
+	};
+	Common::Array<OpaqueSpan> _opaqueSpans;
+	bool _opaqueSpansValid;
 };
 
 } // End of namespace Wintermute
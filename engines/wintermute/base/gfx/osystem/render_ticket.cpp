@@ -44,6 +44,7 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 	        _dstRect(*dstRect),
 	        _isValid(true),
 	        _wantsDraw(true),
+	        _isOccluded(false),
 	        _transform(transform) {
 	if (surf) {
 		_surface = new Graphics::Surface();
@@ -74,11 +75,54 @@ RenderTicket::RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *s
 			delete _surface;
 			_surface = temp;
 		}
+		computeOpaqueRect();
 	} else {
 		_surface = nullptr;
 	}
 }
 
+void RenderTicket::computeOpaqueRect() {
+	// Only plain, unrotated, untiled blits at full opacity are guaranteed
+	// to hide what's beneath their opaque pixels (see doBlitAlphaBlend).
+	if (!_owner ||
+		_transform._angle != Graphics::kDefaultAngle ||
+		_transform._numTimesX * _transform._numTimesY != 1 ||
+		_transform._blendMode != Graphics::BLEND_NORMAL ||
+		(_transform._rgbaMod & 0xff) != 0xff) {
+		return;
+	}
+
+	// Opaque blits ignore the alpha channel entirely
+	if (_transform._alphaDisable && _transform._rgbaMod == Graphics::kDefaultRgbaMod) {
+		_opaqueRect = _dstRect;
+		return;
+	}
+
+	Common::Rect opaque = _owner->getOpaqueRect(_srcRect);
+	if (opaque.isEmpty()) {
+		return;
+	}
+
+	if (_dstRect.width() != _srcRect.width() || _dstRect.height() != _srcRect.height()) {
+		// Bilinear filtering may bleed transparent edges inwards, so only
+		// trust a scaled ticket that is opaque all over and sampled as-is.
+		if (opaque == _srcRect && !_owner->_gameRef->getBilinearFiltering()) {
+			_opaqueRect = _dstRect;
+		}
+		return;
+	}
+
+	int16 top = opaque.top - _srcRect.top;
+	int16 bottom = opaque.bottom - _srcRect.top;
+	if (_transform._flip & Graphics::FLIP_V) {
+		int16 height = _srcRect.height();
+		SWAP(top, bottom);
+		top = height - top;
+		bottom = height - bottom;
+	}
+	_opaqueRect = Common::Rect(_dstRect.left, _dstRect.top + top, _dstRect.right, _dstRect.top + bottom);
+}
+
 RenderTicket::~RenderTicket() {
 	if (_surface) {
 		_surface->free();
@@ -51,7 +51,7 @@ class BaseSurfaceOSystem;
 class RenderTicket {
 public:
 	RenderTicket(BaseSurfaceOSystem *owner, const Graphics::Surface *surf, Common::Rect *srcRect, Common::Rect *dstRest, Graphics::TransformStruct transform);
-	RenderTicket() : _isValid(true), _wantsDraw(false), _transform(Graphics::TransformStruct()) {}
+	RenderTicket() : _isValid(true), _wantsDraw(false), _isOccluded(false), _transform(Graphics::TransformStruct()) {}
 	~RenderTicket();
 	const Graphics::Surface *getSurface() const { return _surface; }
 	// Non-dirty-rects:
@@ -60,9 +60,16 @@ public:
 	void drawToSurface(Graphics::Surface *_targetSurface, Common::Rect *dstRect, Common::Rect *clipRect) const;
 
 	Common::Rect _dstRect;
+	/**
+	 * The part of _dstRect this ticket is guaranteed to cover with fully
+	 * opaque pixels, so anything drawn under it earlier is invisible.
+	 * Empty if the ticket blends with what's beneath it everywhere.
+	 */
+	Common::Rect _opaqueRect;
 
 	bool _isValid;
 	bool _wantsDraw;
+	bool _isOccluded;
 
 	Graphics::TransformStruct _transform;
 
@@ -70,6 +77,7 @@ public:
 	bool operator==(const RenderTicket &a) const;
 	const Common::Rect *getSrcRect() const { return &_srcRect; }
 private:
+	void computeOpaqueRect();
 	Graphics::Surface *_surface;
 	Common::Rect _srcRect;
 };
@@ -37,6 +37,7 @@
 #include "engines/wintermute/base/gfx/base_renderer.h"
 #include "engines/wintermute/base/sound/base_sound.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_stack.h"
 #include "common/savefile.h"
 #include "common/config-manager.h"
 
@@ -92,6 +93,9 @@ bool SaveLoad::saveGame(int slot, const char *desc, bool quickSave, BaseGame *ga
 
 	bool ret;
 
+	// Recycled script values aren't referenced by anything, don't save them
+	SystemClassRegistry::getInstance()->enumInstances(beforeSaveStack, "ScStack", nullptr);
+
 	BasePersistenceManager *pm = new BasePersistenceManager();
 	if (DID_SUCCEED(ret = pm->initSave(desc))) {
 		gameRef->_renderer->initSaveLoad(true, quickSave); // TODO: The original code inited the indicator before the conditionals
@@ -157,6 +161,11 @@ void SaveLoad::afterLoadScript(void *script, void *data) {
 	((ScScript *)script)->afterLoad();
 }
 
+//////////////////////////////////////////////////////////////////////////
+void SaveLoad::beforeSaveStack(void *stack, void *data) {
+	((ScStack *)stack)->freeArena();
+}
+
 Common::String SaveLoad::getSaveSlotFilename(int slot) {
 	Common::String filename;
 	BasePersistenceManager *pm = new BasePersistenceManager();
@@ -50,6 +50,7 @@ private:
 	static void afterLoadSound(void *sound, void *data);
 	static void afterLoadFont(void *font, void *data);
 	static void afterLoadScript(void *script, void *data);
+	static void beforeSaveStack(void *stack, void *data);
 };
 
 } // End of namespace Wintermute
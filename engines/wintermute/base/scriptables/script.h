@@ -40,6 +40,7 @@ class BaseObject;
 class ScEngine;
 class ScStack;
 class ScValue;
+class ScName;
 
 class ScScript : public BaseClass {
 public:
@@ -79,6 +80,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getVar(const ScName &name);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -151,6 +153,7 @@ public:
 	bool externalCall(ScStack *stack, ScStack *thisStack, ScScript::TExternalFunction *function);
 private:
 	char **_symbols;
+	ScName *_symbolNames; // _symbols with their hashes precomputed
 	uint32 _numSymbols;
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
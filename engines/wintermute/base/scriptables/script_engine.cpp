@@ -33,6 +33,7 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/base_file_manager.h"
 #include "engines/wintermute/utils/utils.h"
+#include "common/algorithm.h"
 
 namespace Wintermute {
 
@@ -82,6 +83,7 @@ ScEngine::ScEngine(BaseGame *inGame) : BaseClass(inGame) {
 
 	_isProfiling = false;
 	_profilingStartTime = 0;
+	_instructionCount = 0;
 
 	//EnableProfiling();
 }
@@ -354,6 +356,7 @@ bool ScEngine::tick() {
 			while (_scripts[i]->_state == SCRIPT_RUNNING && g_system->getMillis() - startTime < _scripts[i]->_timeSlice) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				_instructionCount++;
 			}
 			if (_isProfiling && _scripts[i]->_filename) {
 				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
@@ -371,6 +374,7 @@ bool ScEngine::tick() {
 			while (_scripts[i]->_state == SCRIPT_RUNNING) {
 				_currentScript = _scripts[i];
 				_scripts[i]->executeInstruction();
+				_instructionCount++;
 			}
 			if (isProfiling && _scripts[i]->_filename) {
 				addScriptTime(_scripts[i]->_filename, g_system->getMillis() - startTime);
@@ -398,6 +402,7 @@ bool ScEngine::tickUnbreakable() {
 		while (_scripts[i]->_state == SCRIPT_RUNNING) {
 			_currentScript = _scripts[i];
 			_scripts[i]->executeInstruction();
+			_instructionCount++;
 		}
 		_scripts[i]->finish();
 		_currentScript = oldScript;
@@ -601,6 +606,7 @@ void ScEngine::enableProfiling() {
 
 	// destroy old data, if any
 	_scriptTimes.clear();
+	_instructionCount = 0;
 
 	_profilingStartTime = g_system->getMillis();
 	_isProfiling = true;
@@ -620,27 +626,32 @@ void ScEngine::disableProfiling() {
 
 //////////////////////////////////////////////////////////////////////////
 void ScEngine::dumpStats() {
-	error("DumpStats not ported to ScummVM yet");
-	/*  uint32 totalTime = g_system->getMillis() - _profilingStartTime;
+	uint32 totalTime = g_system->getMillis() - _profilingStartTime;
 
-	    typedef std::vector <std::pair<uint32, std::string> > TimeVector;
-	    TimeVector times;
+	struct ScriptTime {
+		uint32 time;
+		Common::String filename;
+	};
+	Common::Array<ScriptTime> times;
 
-	    ScriptTimes::iterator it;
-	    for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
-	        times.push_back(std::pair<uint32, std::string> (it->_value, it->_key));
-	    }
-	    std::sort(times.begin(), times.end());
-
-
-	    TimeVector::reverse_iterator tit;
+	ScriptTimes::iterator it;
+	for (it = _scriptTimes.begin(); it != _scriptTimes.end(); ++it) {
+		ScriptTime entry;
+		entry.time = it->_value;
+		entry.filename = it->_key;
+		times.push_back(entry);
+	}
+	Common::sort(times.begin(), times.end(), [](const ScriptTime &a, const ScriptTime &b) {
+		return a.time > b.time;
+	});
 
-	    _gameRef->LOG(0, "***** Script profiling information: *****");
-	    _gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+	_gameRef->LOG(0, "***** Script profiling information: *****");
+	_gameRef->LOG(0, "  %-40s %fs", "Total execution time", (float)totalTime / 1000);
+	_gameRef->LOG(0, "  %-40s %u", "Instructions executed", _instructionCount);
 
-	    for (tit = times.rbegin(); tit != times.rend(); ++tit) {
-	        _gameRef->LOG(0, "  %-40s %fs (%f%%)", tit->second.c_str(), (float)tit->first / 1000, (float)tit->first / (float)totalTime * 100);
-	    }*/
+	for (uint32 i = 0; i < times.size(); i++) {
+		_gameRef->LOG(0, "  %-40s %fs (%f%%)", times[i].filename.c_str(), (float)times[i].time / 1000, totalTime ? (float)times[i].time / (float)totalTime * 100 : 0.0f);
+	}
 }
 
 } // End of namespace Wintermute
@@ -105,6 +105,9 @@ public:
 	void addScriptTime(const char *filename, uint32 Time);
 	void dumpStats();
 
+	// Number of instructions executed since profiling was last enabled
+	uint32 _instructionCount;
+
 private:
 
 	CScCachedScript *_cachedScripts[MAX_CACHED_SCRIPTS];
@@ -33,6 +33,9 @@ namespace Wintermute {
 
 IMPLEMENT_PERSISTENT(ScStack, false)
 
+// Upper bound on the number of recycled values kept per stack
+static const uint32 kMaxArenaValues = 256;
+
 //////////////////////////////////////////////////////////////////////////
 ScStack::ScStack(BaseGame *inGame) : BaseClass(inGame) {
 	_sP = -1;
@@ -50,6 +53,43 @@ ScStack::~ScStack() {
 		delete _values[i];
 	}
 	_values.clear();
+
+	// Deleting the slots above hands their properties back to the arena
+	freeArena();
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScStack::allocValue() {
+	if (_arenaValues.empty()) {
+		return new ScValue(_gameRef);
+	}
+
+	ScValue *val = _arenaValues.back();
+	_arenaValues.pop_back();
+	return val;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScStack::releaseValue(ScValue *val) {
+	if (_arenaValues.size() >= kMaxArenaValues) {
+		delete val;
+		return;
+	}
+
+	val->cleanup();
+	val->_arena = nullptr;
+	_arenaValues.add(val);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScStack::freeArena() {
+	for (uint32 i = 0; i < _arenaValues.size(); i++) {
+		delete _arenaValues[i];
+	}
+	_arenaValues.clear();
 }
 
 
@@ -76,6 +116,7 @@ void ScStack::push(ScValue *val) {
 		copyVal->copy(val);
 		_values.add(copyVal);
 	}
+	_values[_sP]->_arena = this;
 }
 
 
@@ -88,6 +129,7 @@ ScValue *ScStack::getPushValue() {
 		_values.add(val);
 	}
 	_values[_sP]->cleanup();
+	_values[_sP]->_arena = this;
 	return _values[_sP];
 }
 
@@ -121,7 +163,7 @@ void ScStack::correctParams(uint32 expectedParams) {
 	if (expectedParams < nuParams) { // too many params
 		while (expectedParams < nuParams) {
 			//Pop();
-			delete _values[_sP - expectedParams];
+			releaseValue(_values[_sP - expectedParams]);
 			_values.remove_at(_sP - expectedParams);
 			nuParams--;
 			_sP--;
@@ -129,14 +171,14 @@ void ScStack::correctParams(uint32 expectedParams) {
 	} else if (expectedParams > nuParams) { // need more params
 		while (expectedParams > nuParams) {
 			//Push(null_val);
-			ScValue *nullVal = new ScValue(_gameRef);
+			ScValue *nullVal = allocValue();
 			nullVal->setNULL();
 			_values.insert_at(_sP - nuParams + 1, nullVal);
 			nuParams++;
 			_sP++;
 
 			if ((int32)_values.size() > _sP + 1) {
-				delete _values[_values.size() - 1];
+				releaseValue(_values[_values.size() - 1]);
 				_values.remove_at(_values.size() - 1);
 			}
 		}
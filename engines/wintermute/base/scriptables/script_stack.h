@@ -58,6 +58,22 @@ public:
 	BaseArray<ScValue *> _values;
 	int32 _sP;
 
+	/**
+	 * Get a clean value from the arena, allocating one if it's empty.
+	 */
+	ScValue *allocValue();
+	/**
+	 * Clean a value and keep it in the arena for reuse.
+	 * @param val a value no longer referenced by its owner.
+	 */
+	void releaseValue(ScValue *val);
+	/**
+	 * Free all values waiting in the arena.
+	 */
+	void freeArena();
+private:
+	// Recycled values, mostly the local variables of finished scopes
+	BaseArray<ScValue *> _arenaValues;
 };
 
 } // End of namespace Wintermute
@@ -30,6 +30,7 @@
 #include "engines/wintermute/base/base_game.h"
 #include "engines/wintermute/base/scriptables/script_value.h"
 #include "engines/wintermute/base/scriptables/script.h"
+#include "engines/wintermute/base/scriptables/script_stack.h"
 #include "engines/wintermute/utils/string_util.h"
 #include "engines/wintermute/base/base_scriptable.h"
 
@@ -53,6 +54,7 @@ ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	_arena = nullptr;
 }
 
 
@@ -68,6 +70,7 @@ ScValue::ScValue(BaseGame *inGame, bool val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	_arena = nullptr;
 }
 
 
@@ -83,6 +86,7 @@ ScValue::ScValue(BaseGame *inGame, int32 val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	_arena = nullptr;
 }
 
 
@@ -98,6 +102,7 @@ ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	_arena = nullptr;
 }
 
 
@@ -114,6 +119,7 @@ ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	_arena = nullptr;
 }
 
 
@@ -146,6 +152,7 @@ void ScValue::cleanup(bool ignoreNatives) {
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
+	_arena = nullptr;
 }
 
 
@@ -156,13 +163,38 @@ ScValue::~ScValue() {
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::allocProp() {
+	if (_arena) {
+		return _arena->allocValue();
+	}
+	return new ScValue(_gameRef);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+void ScValue::freeProp(ScValue *val) {
+	if (_arena) {
+		_arena->releaseValue(val);
+	} else {
+		delete val;
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScValue::getProp(const char *name) {
+	return getProp(ScName(name));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+ScValue *ScValue::getProp(const ScName &name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->getProp(name);
 	}
 
-	if (_type == VAL_STRING && strcmp(name, "Length") == 0) {
+	if (_type == VAL_STRING && strcmp(name.c_str(), "Length") == 0) {
 		_gameRef->_scValue->_type = VAL_INT;
 
 		if (_gameRef->_textEncoding == TEXT_ANSI) {
@@ -178,7 +210,7 @@ ScValue *ScValue::getProp(const char *name) {
 	ScValue *ret = nullptr;
 
 	if (_type == VAL_NATIVE && _valNative) {
-		ret = _valNative->scGetProperty(name);
+		ret = _valNative->scGetProperty(name.c_str());
 	}
 
 	if (ret == nullptr) {
@@ -198,7 +230,7 @@ bool ScValue::deleteProp(const char *name) {
 
 	_valIter = _valObject.find(name);
 	if (_valIter != _valObject.end()) {
-		delete _valIter->_value;
+		freeProp(_valIter->_value);
 		_valIter->_value = nullptr;
 	}
 
@@ -209,13 +241,19 @@ bool ScValue::deleteProp(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAsConst) {
+	return setProp(ScName(name), val, copyWhole, setAsConst);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScValue::setProp(const ScName &name, ScValue *val, bool copyWhole, bool setAsConst) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->setProp(name, val);
 	}
 
 	bool ret = STATUS_FAILED;
 	if (_type == VAL_NATIVE && _valNative) {
-		ret = _valNative->scSetProperty(name, val);
+		ret = _valNative->scSetProperty(name.c_str(), val);
 	}
 
 	if (DID_FAIL(ret)) {
@@ -226,7 +264,7 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 			newVal = _valIter->_value;
 		}
 		if (!newVal) {
-			newVal = new ScValue(_gameRef);
+			newVal = allocProp();
 		} else {
 			newVal->cleanup();
 		}
@@ -260,6 +298,12 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::propExists(const char *name) {
+	return propExists(ScName(name));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+bool ScValue::propExists(const ScName &name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->propExists(name);
 	}
@@ -273,7 +317,9 @@ bool ScValue::propExists(const char *name) {
 void ScValue::deleteProps() {
 	_valIter = _valObject.begin();
 	while (_valIter != _valObject.end()) {
-		delete(ScValue *)_valIter->_value;
+		if (_valIter->_value) {
+			freeProp(_valIter->_value);
+		}
 		_valIter++;
 	}
 	_valObject.clear();
@@ -742,8 +788,9 @@ void ScValue::copy(ScValue *orig, bool copyWhole) {
 	if (orig->_type == VAL_OBJECT && orig->_valObject.size() > 0) {
 		orig->_valIter = orig->_valObject.begin();
 		while (orig->_valIter != orig->_valObject.end()) {
-			_valObject[orig->_valIter->_key] = new ScValue(_gameRef);
-			_valObject[orig->_valIter->_key]->copy(orig->_valIter->_value);
+			ScValue *prop = allocProp();
+			prop->copy(orig->_valIter->_value);
+			_valObject[orig->_valIter->_key] = prop;
 			orig->_valIter++;
 		}
 	} else {
@@ -790,6 +837,11 @@ void ScValue::setValue(ScValue *val) {
 bool ScValue::persist(BasePersistenceManager *persistMgr) {
 	persistMgr->transferPtr(TMEMBER_PTR(_gameRef));
 
+	// The owning stack tags its slots again the next time it hands them out
+	if (!persistMgr->getIsSaving()) {
+		_arena = nullptr;
+	}
+
 	persistMgr->transferBool(TMEMBER(_persistent));
 	persistMgr->transferBool(TMEMBER(_isConstVar));
 	persistMgr->transferSint32(TMEMBER_INT(_type));
@@ -962,44 +1014,34 @@ int ScValue::compareStrict(ScValue *val1, ScValue *val2) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, int32 value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, const char *value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, double value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName, bool value) {
-	ScValue *val = new ScValue(_gameRef,  value);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef, value);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProperty(const char *propName) {
-	ScValue *val = new ScValue(_gameRef);
-	bool ret =  DID_SUCCEED(setProp(propName, val));
-	delete val;
-	return ret;
+	ScValue val(_gameRef);
+	return DID_SUCCEED(setProp(propName, &val));
 }
 
 } // End of namespace Wintermute
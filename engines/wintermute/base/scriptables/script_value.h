@@ -33,12 +33,40 @@
 #include "engines/wintermute/persistent.h"
 #include "engines/wintermute/base/scriptables/dcscript.h"   // Added by ClassView
 #include "common/str.h"
+#include "common/hash-str.h"
 
 namespace Wintermute {
 
 class ScScript;
+class ScStack;
 class BaseScriptable;
 
+/**
+ * A property name with its hash computed once up front.
+ * Scripts keep one of these per symbol, so looking up a variable
+ * doesn't rehash its name on every instruction.
+ */
+class ScName {
+public:
+	ScName() : _hash(0) {}
+	ScName(const char *name) : _name(name), _hash(Common::hashit(name)) {}
+	ScName(const Common::String &name) : _name(name), _hash(Common::hashit(name.c_str())) {}
+
+	const char *c_str() const { return _name.c_str(); }
+	uint getHash() const { return _hash; }
+
+	bool operator==(const ScName &other) const {
+		return _hash == other._hash && _name == other._name;
+	}
+private:
+	Common::String _name;
+	uint _hash;
+};
+
+struct ScNameHash {
+	uint operator()(const ScName &name) const { return name.getHash(); }
+};
+
 class ScValue : public BaseClass {
 public:
 	static int compare(ScValue *val1, ScValue *val2);
@@ -52,6 +80,7 @@ public:
 	void setValue(ScValue *val);
 	bool _persistent;
 	bool propExists(const char *name);
+	bool propExists(const ScName &name);
 	void copy(ScValue *orig, bool copyWhole = false);
 	void setStringVal(const char *val);
 	TValType getType();
@@ -81,10 +110,15 @@ public:
 	bool isInt();
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
+	bool setProp(const ScName &name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	ScValue *getProp(const ScName &name);
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 private:
+	ScValue *allocProp();
+	void freeProp(ScValue *val);
+
 	bool _valBool;
 	int32 _valInt;
 	double _valFloat;
@@ -97,8 +131,16 @@ public:
 	ScValue(BaseGame *inGame, double Val);
 	ScValue(BaseGame *inGame, const char *Val);
 	~ScValue() override;
-	Common::HashMap<Common::String, ScValue *> _valObject;
-	Common::HashMap<Common::String, ScValue *>::iterator _valIter;
+	typedef Common::HashMap<ScName, ScValue *, ScNameHash> PropertyMap;
+	PropertyMap _valObject;
+	PropertyMap::iterator _valIter;
+
+	/**
+	 * The stack this value is a slot of, if any. Properties of stack slots
+	 * (such as the local variables of a scope) are recycled through the
+	 * stack's arena instead of being allocated and freed on every call.
+	 */
+	ScStack *_arena;
 
 	bool setProperty(const char *propName, int32 value);
 	bool setProperty(const char *propName, const char *value);
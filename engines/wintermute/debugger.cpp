@@ -35,6 +35,7 @@ Console::Console(WintermuteEngine *vm) : GUI::Debugger(), _engineRef(vm) {
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
 	registerCmd("show_fps", WRAP_METHOD(Console, Cmd_ShowFps));
 	registerCmd("dump_file", WRAP_METHOD(Console, Cmd_DumpFile));
+	registerCmd("overdraw", WRAP_METHOD(Console, Cmd_Overdraw));
 	registerCmd("help", WRAP_METHOD(Console, Cmd_Help));
 	// Actual (script) debugger commands
 	registerCmd(STEP_CMD, WRAP_METHOD(Console, Cmd_Step));
@@ -307,6 +308,20 @@ bool Console::Cmd_ShowFps(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::Cmd_Overdraw(int argc, const char **argv) {
+	if (argc == 1 || (argc == 2 && Common::String(argv[1]) == "reset")) {
+		Common::String stats = CONTROLLER->getDrawStats(argc == 2);
+		if (stats.empty()) {
+			debugPrintf("%s: the current renderer doesn't track overdraw\n", argv[0]);
+		} else {
+			debugPrintf("%s", stats.c_str());
+		}
+	} else {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+	}
+	return true;
+}
+
 bool Console::Cmd_DumpFile(int argc, const char **argv) {
 	if (argc != 3) {
 		debugPrintf("Usage: %s <file path> <output file name>\n", argv[0]);
@@ -105,6 +105,10 @@ public:
 	Common::String getSourcePath() const;
 	Listing *getListing(Error* &err);
 	void showFps(bool show);
+	/**
+	 * @brief get the renderer's overdraw report, and optionally reset its counters.
+	 */
+	Common::String getDrawStats(bool reset);
 	/**
 	 * Inherited from ScriptMonitor
 	 */
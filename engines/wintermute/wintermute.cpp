@@ -62,6 +62,7 @@ WintermuteEngine::WintermuteEngine(OSystem *syst, const WMEGameDescription *desc
 	// in particular, do not load data from files; rather, if you
 	// need to do such things, do them from init().
 	ConfMan.registerDefault("show_fps","false");
+	ConfMan.registerDefault("script_benchmark_frames", 0);
 
 	// Do not initialize graphics here
 
@@ -280,6 +281,17 @@ int WintermuteEngine::messageLoop() {
 
 	const uint32 maxFPS = 60;
 	const uint32 frameTime = 2 * (uint32)((1.0 / maxFPS) * 1000);
+
+	// Script benchmark: run the given number of frames as fast as possible
+	// and without drawing them, then report how long they took and how much
+	// script code ran.
+	int benchmarkFrames = ConfMan.getInt("script_benchmark_frames");
+	int frameCount = 0;
+	uint32 benchmarkStart = time;
+	if (benchmarkFrames > 0 && _game) {
+		_game->_scEngine->enableProfiling();
+	}
+
 	while (!done) {
 		if (!_game) {
 			break;
@@ -290,7 +302,19 @@ int WintermuteEngine::messageLoop() {
 			BasePlatform::handleEvent(&event);
 		}
 
-		if (_game && _game->_renderer->_active && _game->_renderer->isReady()) {
+		if (_game && benchmarkFrames > 0) {
+			_game->updateContent();
+			if (_game->getIsLoading()) {
+				_game->loadGame(_game->_scheduledLoadSlot);
+			}
+
+			if (++frameCount == benchmarkFrames) {
+				uint32 elapsed = _system->getMillis() - benchmarkStart;
+				debug("Script benchmark: %d frames in %u ms, %u script instructions", frameCount, elapsed, _game->_scEngine->_instructionCount);
+				_game->_scEngine->disableProfiling();
+				break;
+			}
+		} else if (_game && _game->_renderer->_active && _game->_renderer->isReady()) {
 			_game->displayContent();
 			_game->displayQuickMsg();
 
@@ -29,10 +29,9 @@
 
 namespace TinyGL {
 
-void GLContext::glopArrayElement(GLParam *param) {
+void GLContext::gl_array_element_attribs(int idx) {
 	int offset;
 	int states = client_states;
-	int idx = param[1].i;
 
 	if (states & COLOR_ARRAY) {
 		GLParam p[5];
@@ -184,88 +183,200 @@ void GLContext::glopArrayElement(GLParam *param) {
 			assert(0);
 		}
 	}
-	if (states & VERTEX_ARRAY) {
-		GLParam p[5];
-		int size = vertex_array_size;
-		offset = idx * vertex_array_stride;
-		switch (vertex_array_type) {
-		case TGL_FLOAT: {
-				TGLfloat *array = (TGLfloat *)((TGLbyte *)vertex_array + offset);
-				p[1].f = array[0];
-				p[2].f = array[1];
-				p[3].f = size > 2 ? array[2] : 0.0f;
-				p[4].f = size > 3 ? array[3] : 1.0f;
-				break;
-			}
-		case TGL_DOUBLE: {
-				TGLdouble *array = (TGLdouble *)((TGLbyte *)vertex_array + offset);
-				p[1].f = array[0];
-				p[2].f = array[1];
-				p[3].f = size > 2 ? array[2] : 0.0f;
-				p[4].f = size > 3 ? array[3] : 1.0f;
-				break;
-			}
-		case TGL_INT: {
-				TGLint *array = (TGLint *)((TGLbyte *)vertex_array + offset);
-				p[1].f = array[0];
-				p[2].f = array[1];
-				p[3].f = size > 2 ? array[2] : 0.0f;
-				p[4].f = size > 3 ? array[3] : 1.0f;
-				break;
-			}
-		case TGL_SHORT: {
-				TGLshort *array = (TGLshort *)((TGLbyte *)vertex_array + offset);
-				p[1].f = array[0];
-				p[2].f = array[1];
-				p[3].f = size > 2 ? array[2] : 0.0f;
-				p[4].f = size > 3 ? array[3] : 1.0f;
-				break;
-			}
-		default:
-			assert(0);
+}
+
+void GLContext::gl_array_element_coord(int idx, Vector4 &coord) {
+	int size = vertex_array_size;
+	int offset = idx * vertex_array_stride;
+	switch (vertex_array_type) {
+	case TGL_FLOAT: {
+			TGLfloat *array = (TGLfloat *)((TGLbyte *)vertex_array + offset);
+			coord.X = array[0];
+			coord.Y = array[1];
+			coord.Z = size > 2 ? array[2] : 0.0f;
+			coord.W = size > 3 ? array[3] : 1.0f;
+			break;
+		}
+	case TGL_DOUBLE: {
+			TGLdouble *array = (TGLdouble *)((TGLbyte *)vertex_array + offset);
+			coord.X = array[0];
+			coord.Y = array[1];
+			coord.Z = size > 2 ? array[2] : 0.0f;
+			coord.W = size > 3 ? array[3] : 1.0f;
+			break;
+		}
+	case TGL_INT: {
+			TGLint *array = (TGLint *)((TGLbyte *)vertex_array + offset);
+			coord.X = array[0];
+			coord.Y = array[1];
+			coord.Z = size > 2 ? array[2] : 0.0f;
+			coord.W = size > 3 ? array[3] : 1.0f;
+			break;
+		}
+	case TGL_SHORT: {
+			TGLshort *array = (TGLshort *)((TGLbyte *)vertex_array + offset);
+			coord.X = array[0];
+			coord.Y = array[1];
+			coord.Z = size > 2 ? array[2] : 0.0f;
+			coord.W = size > 3 ? array[3] : 1.0f;
+			break;
 		}
+	default:
+		assert(0);
+	}
+}
+
+void GLContext::glopArrayElement(GLParam *param) {
+	int idx = param[1].i;
+
+	gl_array_element_attribs(idx);
+	if (client_states & VERTEX_ARRAY) {
+		GLParam p[5];
+		Vector4 coord;
+		gl_array_element_coord(idx, coord);
+		p[1].f = coord.X;
+		p[2].f = coord.Y;
+		p[3].f = coord.Z;
+		p[4].f = coord.W;
 		glopVertex(p);
 	}
 }
 
+bool GLContext::gl_can_batch_array_elements() const {
+	if (!(client_states & VERTEX_ARRAY))
+		return false;
+	// With color material every color of the array changes the material, which
+	// the lighting of the following vertices depends on.
+	return !(lighting_enabled && color_material_enabled && (client_states & COLOR_ARRAY));
+}
+
+// Fills in the vertex from the arrays, for gl_vertex_process_batch().
+void GLContext::gl_array_element_fetch(int idx, GLVertex *v) {
+	gl_array_element_attribs(idx);
+	gl_array_element_coord(idx, v->coord);
+
+	v->normal.X = current_normal.X;
+	v->normal.Y = current_normal.Y;
+	v->normal.Z = current_normal.Z;
+	v->color = current_color;
+	v->tex_coord = current_tex_coord;
+	v->edge_flag = current_edge_flag;
+}
+
+static inline int readIndex(const void *indices, int type, int i) {
+	switch (type) {
+	case TGL_UNSIGNED_BYTE:
+		return ((const TGLbyte *)indices)[i];
+	case TGL_UNSIGNED_SHORT:
+		return ((const TGLshort *)indices)[i];
+	case TGL_UNSIGNED_INT:
+		return ((const TGLint *)indices)[i];
+	default:
+		assert(0);
+		return 0;
+	}
+}
+
+/**
+ * A small direct mapped cache from array indices to processed vertices, so
+ * that the vertices shared by neighbouring triangles are only transformed
+ * and lit once.
+ */
+struct PostTransformCache {
+	enum {
+		kSize = 64
+	};
+
+	int _index[kSize];
+	int _slot[kSize];
+
+	PostTransformCache() {
+		for (int i = 0; i < kSize; i++)
+			_slot[i] = -1;
+	}
+
+	// Returns the slot of the index if it is cached. Otherwise it stores the
+	// index in newSlot and returns -1.
+	int lookup(int idx, int newSlot) {
+		int line = idx & (kSize - 1);
+		if (_slot[line] >= 0 && _index[line] == idx)
+			return _slot[line];
+		_index[line] = idx;
+		_slot[line] = newSlot;
+		return -1;
+	}
+};
+
 void GLContext::glopDrawArrays(GLParam *p) {
-	GLParam array_element[2];
 	GLParam begin[2];
+	int first = p[2].i;
+	int count = p[3].i;
 
 	begin[1].i = p[1].i;
 	glopBegin(begin);
-	for (int i = 0; i < p[3].i; i++) {
-		array_element[1].i = p[2].i + i;
-		glopArrayElement(array_element);
+	if (!gl_can_batch_array_elements()) {
+		GLParam array_element[2];
+		for (int i = 0; i < count; i++) {
+			array_element[1].i = first + i;
+			glopArrayElement(array_element);
+		}
+	} else if (count > 0) {
+		gl_vertex_reserve(vertex_n + count);
+		GLVertex *v = &vertex[vertex_n];
+		for (int i = 0; i < count; i++)
+			gl_array_element_fetch(first + i, &v[i]);
+		gl_vertex_process_batch(v, count);
+
+		vertex_n += count;
+		vertex_cnt += count;
 	}
 	glopEnd(nullptr);
 }
 
 void GLContext::glopDrawElements(GLParam *p) {
-	GLParam array_element[2];
 	void *indices;
 	GLParam begin[2];
+	int count = p[2].i;
+	int type = p[3].i;
 
 	indices = (char *)p[4].p;
 	begin[1].i = p[1].i;
 
 	glopBegin(begin);
-	for (int i = 0; i < p[2].i; i++) {
-		switch (p[3].i) {
-		case TGL_UNSIGNED_BYTE:
-			array_element[1].i = ((TGLbyte *)indices)[i];
-			break;
-		case TGL_UNSIGNED_SHORT:
-			array_element[1].i = ((TGLshort *)indices)[i];
-			break;
-		case TGL_UNSIGNED_INT:
-			array_element[1].i = ((TGLint *)indices)[i];
-			break;
-		default:
-			assert(0);
-			break;
+	if (!gl_can_batch_array_elements()) {
+		GLParam array_element[2];
+		for (int i = 0; i < count; i++) {
+			array_element[1].i = readIndex(indices, type, i);
+			glopArrayElement(array_element);
 		}
-		glopArrayElement(array_element);
+	} else if (count > 0) {
+		// The vertices missing from the cache are fetched past the end of the
+		// output and processed as one block, then the output is filled in
+		// index order by replaying the same cache lookups.
+		gl_vertex_reserve(vertex_n + 2 * count);
+		GLVertex *out = &vertex[vertex_n];
+		GLVertex *unique = out + count;
+		int numUnique = 0;
+
+		PostTransformCache fetchCache;
+		for (int i = 0; i < count; i++) {
+			int idx = readIndex(indices, type, i);
+			if (fetchCache.lookup(idx, numUnique) < 0)
+				gl_array_element_fetch(idx, &unique[numUnique++]);
+		}
+		gl_vertex_process_batch(unique, numUnique);
+
+		PostTransformCache outputCache;
+		numUnique = 0;
+		for (int i = 0; i < count; i++) {
+			int slot = outputCache.lookup(readIndex(indices, type, i), numUnique);
+			if (slot < 0)
+				slot = numUnique++;
+			out[i] = unique[slot];
+		}
+
+		vertex_n += count;
+		vertex_cnt += count;
 	}
 	glopEnd(nullptr);
 }
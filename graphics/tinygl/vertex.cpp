@@ -27,6 +27,7 @@
 
 #include "graphics/tinygl/zgl.h"
 #include "graphics/tinygl/zdirtyrect.h"
+#include "math/simd.h"
 
 namespace TinyGL {
 
@@ -188,6 +189,157 @@ void GLContext::gl_vertex_transform(GLVertex *v) {
 	v->clip_code = gl_clipcode(v->pc.X, v->pc.Y, v->pc.Z, v->pc.W);
 }
 
+#if defined(MATH_SIMD_SSE2) || defined(MATH_SIMD_NEON)
+
+#if defined(MATH_SIMD_SSE2)
+typedef __m128 MatrixColumn;
+
+static inline MatrixColumn loadColumn(const Matrix4 &m, int col) {
+	return _mm_setr_ps(m._m[0][col], m._m[1][col], m._m[2][col], m._m[3][col]);
+}
+
+static inline MatrixColumn combineColumns(const MatrixColumn *c, const Vector4 &v, bool useW) {
+	__m128 r = _mm_mul_ps(_mm_set1_ps(v.X), c[0]);
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(v.Y), c[1]));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(v.Z), c[2]));
+	return _mm_add_ps(r, useW ? _mm_mul_ps(_mm_set1_ps(v.W), c[3]) : c[3]);
+}
+
+static inline void storeColumn(Vector4 &out, MatrixColumn r) {
+	_mm_storeu_ps(out._v, r);
+}
+#else
+typedef float32x4_t MatrixColumn;
+
+static inline MatrixColumn loadColumn(const Matrix4 &m, int col) {
+	const float c[4] = { m._m[0][col], m._m[1][col], m._m[2][col], m._m[3][col] };
+	return vld1q_f32(c);
+}
+
+static inline MatrixColumn combineColumns(const MatrixColumn *c, const Vector4 &v, bool useW) {
+	float32x4_t r = vmulq_n_f32(c[0], v.X);
+	r = vmlaq_n_f32(r, c[1], v.Y);
+	r = vmlaq_n_f32(r, c[2], v.Z);
+	return useW ? vmlaq_n_f32(r, c[3], v.W) : vaddq_f32(r, c[3]);
+}
+
+static inline void storeColumn(Vector4 &out, MatrixColumn r) {
+	vst1q_f32(out._v, r);
+}
+#endif
+
+// Same as Matrix4::transform3x4(): the W of the input is assumed to be 1.
+static inline void transformBatch3x4(const Matrix4 &m, GLVertex *v, int count, Vector4 GLVertex::*in, Vector4 GLVertex::*out) {
+	const MatrixColumn c[4] = { loadColumn(m, 0), loadColumn(m, 1), loadColumn(m, 2), loadColumn(m, 3) };
+	for (int i = 0; i < count; i++)
+		storeColumn(v[i].*out, combineColumns(c, v[i].*in, false));
+}
+
+// Same as Matrix4::transform().
+static inline void transformBatch(const Matrix4 &m, GLVertex *v, int count, Vector4 GLVertex::*in, Vector4 GLVertex::*out) {
+	const MatrixColumn c[4] = { loadColumn(m, 0), loadColumn(m, 1), loadColumn(m, 2), loadColumn(m, 3) };
+	for (int i = 0; i < count; i++)
+		storeColumn(v[i].*out, combineColumns(c, v[i].*in, true));
+}
+
+#else
+
+static inline void transformBatch3x4(const Matrix4 &m, GLVertex *v, int count, Vector4 GLVertex::*in, Vector4 GLVertex::*out) {
+	for (int i = 0; i < count; i++)
+		m.transform3x4(v[i].*in, v[i].*out);
+}
+
+static inline void transformBatch(const Matrix4 &m, GLVertex *v, int count, Vector4 GLVertex::*in, Vector4 GLVertex::*out) {
+	for (int i = 0; i < count; i++)
+		m.transform(v[i].*in, v[i].*out);
+}
+
+#endif
+
+static inline int clipCode(const Vector4 &pc) {
+#if defined(MATH_SIMD_SSE2)
+	// Bits 0-2 of the masks hold the X, Y and Z tests, which are interleaved
+	// into the layout of gl_clipcode().
+	static const int spreadBits[8] = { 0x00, 0x01, 0x04, 0x05, 0x10, 0x11, 0x14, 0x15 };
+	const __m128 p = _mm_loadu_ps(pc._v);
+	const __m128 w = _mm_set1_ps((float)(pc.W * (1.0 + CLIP_EPSILON)));
+	const int below = _mm_movemask_ps(_mm_cmplt_ps(p, _mm_sub_ps(_mm_setzero_ps(), w))) & 7;
+	const int above = _mm_movemask_ps(_mm_cmpgt_ps(p, w)) & 7;
+	return spreadBits[below] | (spreadBits[above] << 1);
+#else
+	return gl_clipcode(pc.X, pc.Y, pc.Z, pc.W);
+#endif
+}
+
+// The same as gl_vertex_transform(), for a block of vertices whose object
+// space normal has been stored in their normal.
+void GLContext::gl_vertex_transform_batch(GLVertex *v, int count) {
+	if (lighting_enabled) {
+		transformBatch3x4(*matrix_stack_ptr[0], v, count, &GLVertex::coord, &GLVertex::ec);
+		transformBatch(*matrix_stack_ptr[1], v, count, &GLVertex::ec, &GLVertex::pc);
+
+		const Matrix4 &m = matrix_model_view_inv;
+		for (int i = 0; i < count; i++) {
+			const Vector3 normal = v[i].normal;
+			m.transform3x3(normal, v[i].normal);
+			if (normalize_enabled) {
+				v[i].normal.normalize();
+			}
+		}
+	} else {
+		const Matrix4 &m = matrix_model_projection;
+		transformBatch3x4(m, v, count, &GLVertex::coord, &GLVertex::pc);
+
+		for (int i = 0; i < count; i++) {
+			if (matrix_model_projection_no_w_transform) {
+				v[i].pc.W = (m._m[3][3]);
+			}
+			v[i].normal.X = v[i].normal.Y = v[i].normal.Z = 0;
+			v[i].ec.X = v[i].ec.Y = v[i].ec.Z = v[i].ec.W = 0;
+		}
+	}
+
+	for (int i = 0; i < count; i++)
+		v[i].clip_code = clipCode(v[i].pc);
+}
+
+// Transforms and shades a block of vertices filled in by gl_array_element_fetch().
+void GLContext::gl_vertex_process_batch(GLVertex *v, int count) {
+	gl_vertex_transform_batch(v, count);
+
+	for (int i = 0; i < count; i++) {
+		if (lighting_enabled) {
+			// The lighting is modulated by the current color.
+			current_color = v[i].color;
+			gl_shade_vertex(&v[i]);
+		}
+
+		if (texture_2d_enabled && apply_texture_matrix) {
+			const Vector4 texCoord = v[i].tex_coord;
+			matrix_stack_ptr[2]->transform(texCoord, v[i].tex_coord);
+		}
+
+		if (v[i].clip_code == 0)
+			gl_transform_to_viewport(&v[i]);
+	}
+}
+
+void GLContext::gl_vertex_reserve(int count) {
+	if (count <= vertex_max)
+		return;
+
+	GLVertex *newarray;
+	while (vertex_max < count)
+		vertex_max <<= 1;    // just double size
+	newarray = (GLVertex *)gl_malloc(sizeof(GLVertex) * vertex_max);
+	if (!newarray) {
+		error("unable to allocate GLVertex array.");
+	}
+	memcpy(newarray, vertex, vertex_n * sizeof(GLVertex));
+	gl_free(vertex);
+	vertex = newarray;
+}
+
 void GLContext::glopVertex(GLParam *p) {
 	GLVertex *v;
 	int n, cnt;
@@ -200,17 +352,7 @@ void GLContext::glopVertex(GLParam *p) {
 	vertex_cnt = cnt;
 
 	// quick fix to avoid crashes on large polygons
-	if (n >= vertex_max) {
-		GLVertex *newarray;
-		vertex_max <<= 1;    // just double size
-		newarray = (GLVertex *)gl_malloc(sizeof(GLVertex) * vertex_max);
-		if (!newarray) {
-			error("unable to allocate GLVertex array.");
-		}
-		memcpy(newarray, vertex, n * sizeof(GLVertex));
-		gl_free(vertex);
-		vertex = newarray;
-	}
+	gl_vertex_reserve(n + 1);
 	// new vertex entry
 	v = &vertex[n];
 	n++;
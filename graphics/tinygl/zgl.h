@@ -435,6 +435,14 @@ struct GLContext {
 	bool _debugRectsEnabled;
 
 	void gl_vertex_transform(GLVertex *v);
+	void gl_vertex_reserve(int count);
+	void gl_vertex_transform_batch(GLVertex *v, int count);
+	void gl_vertex_process_batch(GLVertex *v, int count);
+
+	bool gl_can_batch_array_elements() const;
+	void gl_array_element_attribs(int idx);
+	void gl_array_element_coord(int idx, Vector4 &coord);
+	void gl_array_element_fetch(int idx, GLVertex *v);
 
 public:
 	// The glob* functions exposed to public, however they are only for internal use.
@@ -23,6 +23,8 @@
 #include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
+#include "common/md5.h"
+#include "common/savefile.h"
 #include "common/unzip.h"
 #include "common/tokenizer.h"
 #include "common/translation.h"
@@ -193,7 +195,7 @@ ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(nullptr), _vectorRenderer(nullptr),
 	_layerToDraw(kDrawLayerBackground), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
 	_font(nullptr), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
-	_cursor(nullptr), _scaleFactor(1.0f) {
+	_cursor(nullptr), _scaleFactor(1.0f), _bitmapCacheDirty(false) {
 
 	_baseWidth = 640;	// Default sane values
 	_baseHeight = 480;
@@ -261,6 +263,7 @@ ThemeEngine::~ThemeEngine() {
 		}
 	}
 	_bitmaps.clear();
+	clearBitmapCache();
 
 	delete _parser;
 	delete _themeEval;
@@ -655,12 +658,30 @@ bool ThemeEngine::addBitmap(const Common::String &filename, const Common::String
 	}
 
 	if (!scalablefile.empty()) {
+		const int scaledWidth = width * _scaleFactor;
+		const int scaledHeight = height * _scaleFactor;
+
 		Graphics::SVGBitmap *image = nullptr;
+		Common::String cacheKey;
 		Common::ArchiveMemberList members;
 		_themeFiles.listMatchingMembers(members, scalablefile);
 		for (Common::ArchiveMemberList::const_iterator i = members.begin(), end = members.end(); i != end; ++i) {
 			Common::SeekableReadStream *stream = (*i)->createReadStream();
 			if (stream) {
+				cacheKey = Common::String::format("%s-%dx%d", Common::computeStreamMD5AsString(*stream).c_str(), scaledWidth, scaledHeight);
+
+				BitmapCacheMap::iterator cached = _bitmapCache.find(cacheKey);
+				if (cached != _bitmapCache.end()) {
+					surf = new Graphics::ManagedSurface();
+					surf->copyFrom(*cached->_value.surface);
+					cached->_value.used = true;
+					_bitmaps[filename] = surf;
+
+					delete stream;
+					return true;
+				}
+
+				stream->seek(0);
 				image = new Graphics::SVGBitmap(stream);
 				delete stream;
 				break;
@@ -668,14 +689,21 @@ bool ThemeEngine::addBitmap(const Common::String &filename, const Common::String
 		}
 
 		if (image) {
-			_bitmaps[filename] = new Graphics::ManagedSurface(width * _scaleFactor, height * _scaleFactor, *image->getPixelFormat());
-			image->render(*_bitmaps[filename], width * _scaleFactor, height * _scaleFactor);
+			_bitmaps[filename] = new Graphics::ManagedSurface(scaledWidth, scaledHeight, *image->getPixelFormat());
+			image->render(*_bitmaps[filename], scaledWidth, scaledHeight);
 
 			delete image;
 		} else {
 			return false;
 		}
 
+		CachedBitmap &entry = _bitmapCache[cacheKey];
+		delete entry.surface;
+		entry.surface = new Graphics::ManagedSurface();
+		entry.surface->copyFrom(*_bitmaps[filename]);
+		entry.used = true;
+		_bitmapCacheDirty = true;
+
 		return true;
 	}
 
@@ -755,6 +783,148 @@ bool ThemeEngine::addDrawData(const Common::String &data, bool cached) {
 	return true;
 }
 
+#define THEME_BITMAPCACHE_TAG MKTAG('S', 'V', 'G', 'C')
+#define THEME_BITMAPCACHE_VERSION 1
+
+Common::String ThemeEngine::genBitmapCacheFilename() const {
+	return Common::String::format("%s-%d.tbc", _themeId.c_str(), (int)(_scaleFactor * 100));
+}
+
+void ThemeEngine::loadBitmapCache() {
+	clearBitmapCache();
+
+	Common::InSaveFile *cacheFile = _system->getSavefileManager()->openForLoading(genBitmapCacheFilename());
+	if (!cacheFile)
+		return;
+
+	if (cacheFile->readUint32BE() != THEME_BITMAPCACHE_TAG || cacheFile->readUint32BE() != THEME_BITMAPCACHE_VERSION) {
+		debug(6, "Ignoring outdated bitmap cache '%s'", genBitmapCacheFilename().c_str());
+		delete cacheFile;
+		return;
+	}
+
+	bool valid = true;
+	const uint32 count = cacheFile->readUint32BE();
+	for (uint32 i = 0; i < count; ++i) {
+		const Common::String key = cacheFile->readPascalString(false);
+
+		Graphics::PixelFormat format;
+		format.bytesPerPixel = cacheFile->readByte();
+		format.rLoss = cacheFile->readByte();
+		format.gLoss = cacheFile->readByte();
+		format.bLoss = cacheFile->readByte();
+		format.aLoss = cacheFile->readByte();
+		format.rShift = cacheFile->readByte();
+		format.gShift = cacheFile->readByte();
+		format.bShift = cacheFile->readByte();
+		format.aShift = cacheFile->readByte();
+
+		const uint16 w = cacheFile->readUint16BE();
+		const uint16 h = cacheFile->readUint16BE();
+
+		if (cacheFile->eos() || cacheFile->err() || format.bytesPerPixel == 0 || format.bytesPerPixel > 4) {
+			valid = false;
+			break;
+		}
+
+		// The key ends with the size the bitmap was rasterized at, and the
+		// pixels have to fit in what is left of the file.
+		int keyWidth, keyHeight;
+		const char *keySize = strrchr(key.c_str(), '-');
+		if (!keySize || sscanf(keySize, "-%dx%d", &keyWidth, &keyHeight) != 2 || keyWidth != w || keyHeight != h ||
+		        (int64)w * h * format.bytesPerPixel > cacheFile->size() - cacheFile->pos()) {
+			valid = false;
+			break;
+		}
+
+		Graphics::ManagedSurface *surf = new Graphics::ManagedSurface(w, h, format);
+		for (uint16 y = 0; y < h; ++y)
+			cacheFile->read(surf->getBasePtr(0, y), w * format.bytesPerPixel);
+
+		if (cacheFile->eos() || cacheFile->err()) {
+			delete surf;
+			valid = false;
+			break;
+		}
+
+		CachedBitmap &entry = _bitmapCache[key];
+		delete entry.surface;
+		entry.surface = surf;
+		entry.used = false;
+	}
+
+	if (!valid) {
+		warning("Ignoring corrupt bitmap cache '%s'", genBitmapCacheFilename().c_str());
+		clearBitmapCache();
+	}
+
+	delete cacheFile;
+}
+
+void ThemeEngine::saveBitmapCache() {
+	// Rewrite the cache when new bitmaps were rasterized, or when it contains
+	// entries this theme no longer uses.
+	uint32 count = 0;
+	bool stale = false;
+	for (BitmapCacheMap::const_iterator i = _bitmapCache.begin(); i != _bitmapCache.end(); ++i) {
+		if (i->_value.used)
+			++count;
+		else
+			stale = true;
+	}
+
+	if (!_bitmapCacheDirty && !stale)
+		return;
+
+	Common::OutSaveFile *cacheFile = _system->getSavefileManager()->openForSaving(genBitmapCacheFilename(), false);
+	if (!cacheFile) {
+		warning("Couldn't create bitmap cache file for theme '%s'", _themeId.c_str());
+		return;
+	}
+
+	cacheFile->writeUint32BE(THEME_BITMAPCACHE_TAG);
+	cacheFile->writeUint32BE(THEME_BITMAPCACHE_VERSION);
+	cacheFile->writeUint32BE(count);
+
+	for (BitmapCacheMap::const_iterator i = _bitmapCache.begin(); i != _bitmapCache.end(); ++i) {
+		if (!i->_value.used)
+			continue;
+
+		const Graphics::ManagedSurface *surf = i->_value.surface;
+		const Graphics::PixelFormat &format = surf->format;
+
+		cacheFile->writeByte(i->_key.size());
+		cacheFile->writeString(i->_key);
+
+		cacheFile->writeByte(format.bytesPerPixel);
+		cacheFile->writeByte(format.rLoss);
+		cacheFile->writeByte(format.gLoss);
+		cacheFile->writeByte(format.bLoss);
+		cacheFile->writeByte(format.aLoss);
+		cacheFile->writeByte(format.rShift);
+		cacheFile->writeByte(format.gShift);
+		cacheFile->writeByte(format.bShift);
+		cacheFile->writeByte(format.aShift);
+
+		cacheFile->writeUint16BE(surf->w);
+		cacheFile->writeUint16BE(surf->h);
+		for (int y = 0; y < surf->h; ++y)
+			cacheFile->write(surf->getBasePtr(0, y), surf->w * format.bytesPerPixel);
+	}
+
+	cacheFile->finalize();
+	if (cacheFile->err())
+		warning("Couldn't write bitmap cache file for theme '%s'", _themeId.c_str());
+	delete cacheFile;
+}
+
+void ThemeEngine::clearBitmapCache() {
+	for (BitmapCacheMap::iterator i = _bitmapCache.begin(); i != _bitmapCache.end(); ++i)
+		delete i->_value.surface;
+	_bitmapCache.clear();
+	_bitmapCacheDirty = false;
+}
+
 
 /**********************************************************
  * Theme XML loading
@@ -764,6 +934,8 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 
 	debug(6, "Loading theme %s", themeId.c_str());
 
+	loadBitmapCache();
+
 	if (themeId == "builtin") {
 		_themeOk = loadDefaultXML();
 	} else {
@@ -771,6 +943,10 @@ void ThemeEngine::loadTheme(const Common::String &themeId) {
 		_themeOk = loadThemeXML(themeId);
 	}
 
+	if (_themeOk)
+		saveBitmapCache();
+	clearBitmapCache();
+
 	if (!_themeOk) {
 		warning("Failed to load theme '%s'", themeId.c_str());
 		return;
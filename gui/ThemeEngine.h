@@ -203,6 +203,13 @@ class ThemeEngine {
 protected:
 	typedef Common::HashMap<Common::String, Graphics::ManagedSurface *> ImagesMap;
 
+	/** A rasterized scalable bitmap, as stored in the bitmap cache file. */
+	struct CachedBitmap {
+		Graphics::ManagedSurface *surface;
+		bool used;
+	};
+	typedef Common::HashMap<Common::String, CachedBitmap> BitmapCacheMap;
+
 	friend class GUI::Dialog;
 	friend class GUI::GuiObject;
 
@@ -683,6 +690,20 @@ protected:
 	const Graphics::Font *loadScalableFont(const Common::String &filename, const int pointsize, Common::String &name);
 	const Graphics::Font *loadFont(const Common::String &filename, Common::String &name);
 	Common::String genCacheFilename(const Common::String &filename) const;
+
+	/**
+	 * Scalable bitmap cache handling.
+	 *
+	 * Rasterizing the SVG images of a theme is the most expensive part of
+	 * loading it, so the rendered surfaces are kept in a binary cache file,
+	 * one per theme and scale factor. Entries are keyed by the MD5 of the SVG
+	 * source and the target size, so a changed theme simply misses the cache
+	 * and falls back to rasterizing.
+	 */
+	Common::String genBitmapCacheFilename() const;
+	void loadBitmapCache();
+	void saveBitmapCache();
+	void clearBitmapCache();
 	const Graphics::Font *loadFont(const Common::String &filename, const Common::String &scalableFilename, const int pointsize, const bool makeLocalizedFont);
 
 	/**
@@ -787,6 +808,8 @@ protected:
 	Common::Array<LangExtraFont> _langExtraFonts;
 
 	ImagesMap _bitmaps;
+	BitmapCacheMap _bitmapCache;
+	bool _bitmapCacheDirty;
 	Graphics::PixelFormat _overlayFormat;
 	Graphics::PixelFormat _cursorFormat;
 
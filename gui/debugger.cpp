@@ -25,6 +25,7 @@
 #include "common/file.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/iostats.h"
 #include "common/system.h"
 
 #ifndef DISABLE_MD5
@@ -73,6 +74,7 @@ Debugger::Debugger() {
 	registerCmd("md5mac",			WRAP_METHOD(Debugger, cmdMd5Mac));
 #endif
 	registerCmd("exec",				WRAP_METHOD(Debugger, cmdExecFile));
+	registerCmd("iostats",			WRAP_METHOD(Debugger, cmdIOStats));
 
 	registerCmd("debuglevel",		WRAP_METHOD(Debugger, cmdDebugLevel));
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
@@ -719,6 +721,28 @@ bool Debugger::cmdMd5Mac(int argc, const char **argv) {
 }
 #endif
 
+bool Debugger::cmdIOStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	if (argc == 2) {
+		Common::IOStats::reset();
+		debugPrintf("File I/O counters reset\n");
+		return true;
+	}
+
+	const Common::IOStats::Counters stats = Common::IOStats::get();
+	debugPrintf("Files opened: %u\n", stats.opened);
+	debugPrintf("Read calls:   %u\n", stats.reads);
+	debugPrintf("Seek calls:   %u\n", stats.seeks);
+	debugPrintf("OS hints:     %u\n", stats.hints);
+	debugPrintf("Bytes read:   %llu\n", (unsigned long long)stats.bytesRead);
+	debugPrintf("(Files still open are counted once they are closed)\n");
+	return true;
+}
+
 bool Debugger::cmdDebugLevel(int argc, const char **argv) {
 	if (argc == 1) { // print level
 		debugPrintf("Debugging is currently %s (set at level %d)\n", (gDebugLevel >= 0) ? "enabled" : "disabled", gDebugLevel);
@@ -22,9 +22,41 @@
 #include "math/matrix4.h"
 #include "math/vector4d.h"
 #include "math/squarematrix.h"
+#include "math/simd.h"
 
 namespace Math {
 
+// The vector kernels below access the matrix through getData() as 16
+// contiguous floats in row-major order.
+STATIC_ASSERT(sizeof(Matrix4) == 16 * sizeof(float), Matrix4_data_must_be_contiguous);
+
+/**
+ * Computes out = c[0] * rows[0..3] + c[1] * rows[4..7] + c[2] * rows[8..11] + c[3] * rows[12..15],
+ * which is one row of a 4x4 matrix product, or a row vector times a matrix.
+ */
+static inline void combineRows(const float *rows, const float *c, float *out) {
+#if defined(MATH_SIMD_SSE2)
+	__m128 r = _mm_mul_ps(_mm_set1_ps(c[0]), _mm_loadu_ps(rows + 0));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(c[1]), _mm_loadu_ps(rows + 4)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(c[2]), _mm_loadu_ps(rows + 8)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(c[3]), _mm_loadu_ps(rows + 12)));
+	_mm_storeu_ps(out, r);
+#elif defined(MATH_SIMD_NEON)
+	float32x4_t r = vmulq_n_f32(vld1q_f32(rows + 0), c[0]);
+	r = vmlaq_n_f32(r, vld1q_f32(rows + 4), c[1]);
+	r = vmlaq_n_f32(r, vld1q_f32(rows + 8), c[2]);
+	r = vmlaq_n_f32(r, vld1q_f32(rows + 12), c[3]);
+	vst1q_f32(out, r);
+#else
+	for (int j = 0; j < 4; ++j) {
+		out[j] = (c[0] * rows[j + 0])
+			+ (c[1] * rows[j + 4])
+			+ (c[2] * rows[j + 8])
+			+ (c[3] * rows[j + 12]);
+	}
+#endif
+}
+
 Matrix<4, 4>::Matrix() :
 	MatrixType<4, 4>(), Rotation3D<Matrix4>() {
 }
@@ -33,16 +65,36 @@ Matrix<4, 4>::Matrix(const MatrixBase<4, 4> &m) :
 	MatrixType<4, 4>(m), Rotation3D<Matrix4>() {
 }
 
-void Matrix<4, 4>::transform(Vector3d *v, bool trans) const {
-	Vector4d m;
-	m(0, 0) = v->x();
-	m(1, 0) = v->y();
-	m(2, 0) = v->z();
-	m(3, 0) = (trans ? 1.f : 0.f);
+Matrix<4, 4> Matrix<4, 4>::operator*(const Matrix<4, 4> &m2) const {
+	Matrix<4, 4> result;
+	const float *d1 = getData();
+	const float *d2 = m2.getData();
+	float *r = result.getData();
 
-	m = *this * m;
+	for (int i = 0; i < 16; i += 4)
+		combineRows(d2, d1 + i, r + i);
 
-	v->set(m(0, 0), m(1, 0), m(2, 0));
+	return result;
+}
+
+Vector4d Matrix<4, 4>::transform(const Vector4d &v) const {
+	Vector4d result;
+	combineRows(getData(), v.getData(), result.getData());
+	return result;
+}
+
+void Matrix<4, 4>::transform(Vector3d *v, bool trans) const {
+	// A column vector times the matrix, i.e. dot products with the rows. Doing
+	// it directly avoids going through the generic 4x1 matrix product.
+	const float *m = getData();
+	const float x = v->x();
+	const float y = v->y();
+	const float z = v->z();
+	const float w = trans ? 1.f : 0.f;
+
+	v->set(m[0] * x + m[1] * y + m[2] * z + m[3] * w,
+	       m[4] * x + m[5] * y + m[6] * z + m[7] * w,
+	       m[8] * x + m[9] * y + m[10] * z + m[11] * w);
 }
 
 Vector3d Matrix<4, 4>::getPosition() const {
@@ -115,6 +167,56 @@ void Matrix<4, 4>::invertAffineOrthonormal() {
 	setPosition(position);
 }
 
+bool Matrix<4, 4>::inverse() {
+	float *m = getData();
+
+	// The 2x2 sub-determinants of the top and the bottom two rows are shared
+	// between the cofactors, which halves the number of multiplications.
+	const float a0 = m[0] * m[5] - m[1] * m[4];
+	const float a1 = m[0] * m[6] - m[2] * m[4];
+	const float a2 = m[0] * m[7] - m[3] * m[4];
+	const float a3 = m[1] * m[6] - m[2] * m[5];
+	const float a4 = m[1] * m[7] - m[3] * m[5];
+	const float a5 = m[2] * m[7] - m[3] * m[6];
+	const float b0 = m[8] * m[13] - m[9] * m[12];
+	const float b1 = m[8] * m[14] - m[10] * m[12];
+	const float b2 = m[8] * m[15] - m[11] * m[12];
+	const float b3 = m[9] * m[14] - m[10] * m[13];
+	const float b4 = m[9] * m[15] - m[11] * m[13];
+	const float b5 = m[10] * m[15] - m[11] * m[14];
+
+	float det = a0 * b5 - a1 * b4 + a2 * b3 + a3 * b2 - a4 * b1 + a5 * b0;
+
+	if (det == 0)
+		return false;
+
+	det = 1.0f / det;
+
+	float inv[16];
+	inv[0] = m[5] * b5 - m[6] * b4 + m[7] * b3;
+	inv[1] = -m[1] * b5 + m[2] * b4 - m[3] * b3;
+	inv[2] = m[13] * a5 - m[14] * a4 + m[15] * a3;
+	inv[3] = -m[9] * a5 + m[10] * a4 - m[11] * a3;
+	inv[4] = -m[4] * b5 + m[6] * b2 - m[7] * b1;
+	inv[5] = m[0] * b5 - m[2] * b2 + m[3] * b1;
+	inv[6] = -m[12] * a5 + m[14] * a2 - m[15] * a1;
+	inv[7] = m[8] * a5 - m[10] * a2 + m[11] * a1;
+	inv[8] = m[4] * b4 - m[5] * b2 + m[7] * b0;
+	inv[9] = -m[0] * b4 + m[1] * b2 - m[3] * b0;
+	inv[10] = m[12] * a4 - m[13] * a2 + m[15] * a0;
+	inv[11] = -m[8] * a4 + m[9] * a2 - m[11] * a0;
+	inv[12] = -m[4] * b3 + m[5] * b1 - m[6] * b0;
+	inv[13] = m[0] * b3 - m[1] * b1 + m[2] * b0;
+	inv[14] = -m[12] * a3 + m[13] * a1 - m[14] * a0;
+	inv[15] = m[8] * a3 - m[9] * a1 + m[10] * a0;
+
+	for (int i = 0; i < 16; i++) {
+		m[i] = inv[i] * det;
+	}
+
+	return true;
+}
+
 void swap (float &a, float &b);
 
 void Matrix<4, 4>::transpose() {
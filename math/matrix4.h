@@ -74,170 +74,15 @@ public:
 
 	void transpose();
 
-	inline Matrix<4, 4> operator*(const Matrix<4, 4> &m2) const {
-		Matrix<4, 4> result;
-		const float *d1 = getData();
-		const float *d2 = m2.getData();
-		float *r = result.getData();
-
-		for (int i = 0; i < 16; i += 4) {
-			for (int j = 0; j < 4; ++j) {
-				r[i + j] = (d1[i + 0] * d2[j + 0])
-					+ (d1[i + 1] * d2[j + 4])
-					+ (d1[i + 2] * d2[j + 8])
-					+ (d1[i + 3] * d2[j + 12]);
-			}
-		}
-
-		return result;
-	}
-
-	inline Vector4d transform(const Vector4d &v) const {
-		Vector4d result;
-		const float *d1 = getData();
-		const float *d2 = v.getData();
-		float *r = result.getData();
-
-		for (int i = 0; i < 4; i++) {
-			r[i] = d2[0] * d1[0 * 4 + i] +
-			       d2[1] * d1[1 * 4 + i] +
-			       d2[2] * d1[2 * 4 + i] +
-			       d2[3] * d1[3 * 4 + i];
-		}
-
-		return result;
-	}
-
-	inline bool inverse() {
-		Matrix<4, 4> invMatrix;
-		float *inv = invMatrix.getData();
-		float *m = getData();
-
-		inv[0] = m[5]  * m[10] * m[15] -
-			m[5]  * m[11] * m[14] -
-			m[9]  * m[6]  * m[15] +
-			m[9]  * m[7]  * m[14] +
-			m[13] * m[6]  * m[11] -
-			m[13] * m[7]  * m[10];
-
-		inv[4] = -m[4]  * m[10] * m[15] +
-			m[4]  * m[11] * m[14] +
-			m[8]  * m[6]  * m[15] -
-			m[8]  * m[7]  * m[14] -
-			m[12] * m[6]  * m[11] +
-			m[12] * m[7]  * m[10];
-
-		inv[8] = m[4]  * m[9] * m[15] -
-			m[4]  * m[11] * m[13] -
-			m[8]  * m[5] * m[15] +
-			m[8]  * m[7] * m[13] +
-			m[12] * m[5] * m[11] -
-			m[12] * m[7] * m[9];
-
-		inv[12] = -m[4]  * m[9] * m[14] +
-			m[4]  * m[10] * m[13] +
-			m[8]  * m[5] * m[14] -
-			m[8]  * m[6] * m[13] -
-			m[12] * m[5] * m[10] +
-			m[12] * m[6] * m[9];
-
-		inv[1] = -m[1]  * m[10] * m[15] +
-			m[1]  * m[11] * m[14] +
-			m[9]  * m[2] * m[15] -
-			m[9]  * m[3] * m[14] -
-			m[13] * m[2] * m[11] +
-			m[13] * m[3] * m[10];
-
-		inv[5] = m[0]  * m[10] * m[15] -
-			m[0]  * m[11] * m[14] -
-			m[8]  * m[2] * m[15] +
-			m[8]  * m[3] * m[14] +
-			m[12] * m[2] * m[11] -
-			m[12] * m[3] * m[10];
-
-		inv[9] = -m[0]  * m[9] * m[15] +
-			m[0]  * m[11] * m[13] +
-			m[8]  * m[1] * m[15] -
-			m[8]  * m[3] * m[13] -
-			m[12] * m[1] * m[11] +
-			m[12] * m[3] * m[9];
-
-		inv[13] = m[0]  * m[9] * m[14] -
-			m[0]  * m[10] * m[13] -
-			m[8]  * m[1] * m[14] +
-			m[8]  * m[2] * m[13] +
-			m[12] * m[1] * m[10] -
-			m[12] * m[2] * m[9];
-
-		inv[2] = m[1]  * m[6] * m[15] -
-			m[1]  * m[7] * m[14] -
-			m[5]  * m[2] * m[15] +
-			m[5]  * m[3] * m[14] +
-			m[13] * m[2] * m[7] -
-			m[13] * m[3] * m[6];
-
-		inv[6] = -m[0]  * m[6] * m[15] +
-			m[0]  * m[7] * m[14] +
-			m[4]  * m[2] * m[15] -
-			m[4]  * m[3] * m[14] -
-			m[12] * m[2] * m[7] +
-			m[12] * m[3] * m[6];
-
-		inv[10] = m[0]  * m[5] * m[15] -
-			m[0]  * m[7] * m[13] -
-			m[4]  * m[1] * m[15] +
-			m[4]  * m[3] * m[13] +
-			m[12] * m[1] * m[7] -
-			m[12] * m[3] * m[5];
-
-		inv[14] = -m[0]  * m[5] * m[14] +
-			m[0]  * m[6] * m[13] +
-			m[4]  * m[1] * m[14] -
-			m[4]  * m[2] * m[13] -
-			m[12] * m[1] * m[6] +
-			m[12] * m[2] * m[5];
-
-		inv[3] = -m[1] * m[6] * m[11] +
-			m[1] * m[7] * m[10] +
-			m[5] * m[2] * m[11] -
-			m[5] * m[3] * m[10] -
-			m[9] * m[2] * m[7] +
-			m[9] * m[3] * m[6];
-
-		inv[7] = m[0] * m[6] * m[11] -
-			m[0] * m[7] * m[10] -
-			m[4] * m[2] * m[11] +
-			m[4] * m[3] * m[10] +
-			m[8] * m[2] * m[7] -
-			m[8] * m[3] * m[6];
-
-		inv[11] = -m[0] * m[5] * m[11] +
-			m[0] * m[7] * m[9] +
-			m[4] * m[1] * m[11] -
-			m[4] * m[3] * m[9] -
-			m[8] * m[1] * m[7] +
-			m[8] * m[3] * m[5];
-
-		inv[15] = m[0] * m[5] * m[10] -
-			m[0] * m[6] * m[9] -
-			m[4] * m[1] * m[10] +
-			m[4] * m[2] * m[9] +
-			m[8] * m[1] * m[6] -
-			m[8] * m[2] * m[5];
-
-		float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
-
-		if (det == 0)
-			return false;
-
-		det = 1.0 / det;
-
-		for (int i = 0; i < 16; i++) {
-			m[i] = inv[i] * det;
-		}
-
-		return true;
-	}
+	Matrix<4, 4> operator*(const Matrix<4, 4> &m2) const;
+
+	Vector4d transform(const Vector4d &v) const;
+
+	/**
+	 * Inverts a generic matrix in place.
+	 * @return false if the matrix is singular, in which case it is left unchanged.
+	 */
+	bool inverse();
 };
 
 typedef Matrix<4, 4> Matrix4;
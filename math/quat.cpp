@@ -39,6 +39,7 @@
 
 #include "common/math.h"
 #include "math/quat.h"
+#include "math/simd.h"
 
 namespace Math {
 
@@ -247,12 +248,50 @@ Quaternion& Quaternion::operator=(const Quaternion& quat) {
 }
 
 Quaternion Quaternion::operator*(const Quaternion &o) const {
+#if defined(MATH_SIMD_SSE2) || defined(MATH_SIMD_NEON)
+	// The product is w * o plus x, y and z times sign-flipped permutations of o:
+	// x * ( o.w, -o.z,  o.y, -o.x)
+	// y * ( o.z,  o.w, -o.x, -o.y)
+	// z * (-o.y,  o.x,  o.w, -o.z)
+	Quaternion result;
+	const float *q = getData();
+#if defined(MATH_SIMD_SSE2)
+	const __m128 v = _mm_loadu_ps(o.getData());
+	const __m128 px = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(1.f, -1.f, 1.f, -1.f));
+	const __m128 py = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(1.f, 1.f, -1.f, -1.f));
+	const __m128 pz = _mm_mul_ps(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-1.f, 1.f, 1.f, -1.f));
+
+	__m128 r = _mm_mul_ps(_mm_set1_ps(q[3]), v);
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q[0]), px));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q[1]), py));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_set1_ps(q[2]), pz));
+	_mm_storeu_ps(result.getData(), r);
+#else
+	static const float signX[4] = { 1.f, -1.f, 1.f, -1.f };
+	static const float signY[4] = { 1.f, 1.f, -1.f, -1.f };
+	static const float signZ[4] = { -1.f, 1.f, 1.f, -1.f };
+
+	const float32x4_t v = vld1q_f32(o.getData());
+	const float32x4_t vy = vextq_f32(v, v, 2);
+	const float32x4_t px = vmulq_f32(vrev64q_f32(vy), vld1q_f32(signX));
+	const float32x4_t py = vmulq_f32(vy, vld1q_f32(signY));
+	const float32x4_t pz = vmulq_f32(vrev64q_f32(v), vld1q_f32(signZ));
+
+	float32x4_t r = vmulq_n_f32(v, q[3]);
+	r = vmlaq_n_f32(r, px, q[0]);
+	r = vmlaq_n_f32(r, py, q[1]);
+	r = vmlaq_n_f32(r, pz, q[2]);
+	vst1q_f32(result.getData(), r);
+#endif
+	return result;
+#else
 	return Quaternion(
 		w() * o.x() + x() * o.w() + y() * o.z() - z() * o.y(),
 		w() * o.y() - x() * o.z() + y() * o.w() + z() * o.x(),
 		w() * o.z() + x() * o.y() - y() * o.x() + z() * o.w(),
 		w() * o.w() - x() * o.x() - y() * o.y() - z() * o.z()
 	);
+#endif
 }
 
 Quaternion Quaternion::operator*(const float c) const {
@@ -0,0 +1,141 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive-readqueue.h"
+#include "common/memstream.h"
+#include "../null_osystem.h"
+
+namespace {
+
+class TestArchive : public Common::Archive {
+public:
+	mutable int _reads;
+
+	TestArchive() : _reads(0) {}
+
+	// Spans several chunks, so it takes more than one read to load
+	static const uint32 kLargeSize = Common::ArchiveReadQueue::kChunkSize * 2 + 3;
+
+	bool hasFile(const Common::Path &path) const override {
+		return path.toString() == "present" || path.toString() == "large";
+	}
+
+	int listMembers(Common::ArchiveMemberList &list) const override {
+		return 0;
+	}
+
+	const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override {
+		return Common::ArchiveMemberPtr();
+	}
+
+	Common::SeekableReadStream *createReadStreamForMember(const Common::Path &path) const override {
+		static const byte contents[] = { 1, 2, 3, 4 };
+		_reads++;
+		if (!hasFile(path))
+			return nullptr;
+		if (path.toString() == "large") {
+			byte *data = (byte *)malloc(kLargeSize);
+			for (uint32 i = 0; i < kLargeSize; i++)
+				data[i] = i & 0xFF;
+			return new Common::MemoryReadStream(data, kLargeSize, DisposeAfterUse::YES);
+		}
+		return new Common::MemoryReadStream(contents, sizeof(contents));
+	}
+};
+
+} // End of anonymous namespace
+
+class ArchiveReadQueueTestSuite : public CxxTest::TestSuite {
+public:
+	void test_take_stream() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+		TestArchive archive;
+
+		Common::ArchiveReadRequestPtr request = ArchiveReadMan.submit(&archive, "present");
+		TS_ASSERT_EQUALS(ArchiveReadMan.getState(request), Common::ArchiveReadRequest::kStatePending);
+
+		// Pending requests are loaded on demand
+		Common::SeekableReadStream *stream = ArchiveReadMan.takeStream(request);
+		TS_ASSERT(stream != nullptr);
+		TS_ASSERT_EQUALS(stream->size(), 4);
+		TS_ASSERT_EQUALS(stream->readUint32BE(), 0x01020304UL);
+		delete stream;
+
+		// The data can only be taken once
+		TS_ASSERT(ArchiveReadMan.takeStream(request) == nullptr);
+		TS_ASSERT_EQUALS(archive._reads, 1);
+#endif
+	}
+
+	void test_handle_in_order() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+		TestArchive archive;
+
+		Common::Array<Common::Path> members;
+		members.push_back("present");
+		members.push_back("missing");
+
+		Common::Array<Common::ArchiveReadRequestPtr> requests;
+		ArchiveReadMan.submit(&archive, members, requests);
+		TS_ASSERT_EQUALS(requests.size(), 2u);
+
+		TS_ASSERT(ArchiveReadMan.handle());
+		TS_ASSERT_EQUALS(ArchiveReadMan.getState(requests[0]), Common::ArchiveReadRequest::kStateDone);
+		TS_ASSERT_EQUALS(ArchiveReadMan.getState(requests[1]), Common::ArchiveReadRequest::kStatePending);
+
+		TS_ASSERT(ArchiveReadMan.handle());
+		TS_ASSERT_EQUALS(ArchiveReadMan.getState(requests[1]), Common::ArchiveReadRequest::kStateFailed);
+		TS_ASSERT(ArchiveReadMan.takeStream(requests[1]) == nullptr);
+
+		TS_ASSERT(!ArchiveReadMan.handle());
+
+		Common::SeekableReadStream *stream = ArchiveReadMan.takeStream(requests[0]);
+		TS_ASSERT(stream != nullptr);
+		delete stream;
+#endif
+	}
+
+	void test_load_in_chunks() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+		TestArchive archive;
+
+		Common::ArchiveReadRequestPtr request = ArchiveReadMan.submit(&archive, "large");
+		for (int i = 0; i < 10 && ArchiveReadMan.getState(request) != Common::ArchiveReadRequest::kStateDone; i++)
+			TS_ASSERT(ArchiveReadMan.handle());
+		TS_ASSERT_EQUALS(ArchiveReadMan.getState(request), Common::ArchiveReadRequest::kStateDone);
+		TS_ASSERT(!ArchiveReadMan.handle());
+
+		Common::SeekableReadStream *stream = ArchiveReadMan.takeStream(request);
+		TS_ASSERT(stream != nullptr);
+		TS_ASSERT_EQUALS(stream->size(), (int64)TestArchive::kLargeSize);
+		bool matches = true;
+		for (uint32 i = 0; i < TestArchive::kLargeSize; i++)
+			matches = matches && stream->readByte() == (i & 0xFF);
+		TS_ASSERT(matches);
+		delete stream;
+		TS_ASSERT_EQUALS(archive._reads, 1);
+#endif
+	}
+
+	void test_cancel() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+		TestArchive archive;
+
+		Common::ArchiveReadRequestPtr request1 = ArchiveReadMan.submit(&archive, "present");
+		Common::ArchiveReadRequestPtr request2 = ArchiveReadMan.submit(&archive, "present");
+
+		ArchiveReadMan.cancel(request1);
+		TS_ASSERT_EQUALS(ArchiveReadMan.getState(request1), Common::ArchiveReadRequest::kStateCancelled);
+
+		ArchiveReadMan.cancelAll(&archive);
+		TS_ASSERT_EQUALS(ArchiveReadMan.getState(request2), Common::ArchiveReadRequest::kStateCancelled);
+
+		TS_ASSERT(!ArchiveReadMan.handle());
+		TS_ASSERT(ArchiveReadMan.takeStream(request2) == nullptr);
+		TS_ASSERT_EQUALS(archive._reads, 0);
+#endif
+	}
+};
@@ -248,6 +248,42 @@ class ArrayTestSuite : public CxxTest::TestSuite
 		}
 	}
 
+	struct MoveTracker {
+		int value;
+		bool movedFrom;
+
+		MoveTracker(int v) : value(v), movedFrom(false) {}
+		MoveTracker(const MoveTracker &other) : value(other.value), movedFrom(false) {}
+		MoveTracker(MoveTracker &&other) : value(other.value), movedFrom(false) {
+			other.movedFrom = true;
+		}
+		MoveTracker &operator=(const MoveTracker &other) {
+			value = other.value;
+			movedFrom = false;
+			return *this;
+		}
+	};
+
+	void test_push_back_move() {
+		Common::Array<MoveTracker> array;
+		array.reserve(2);
+
+		MoveTracker copied(1), moved(2);
+		array.push_back(copied);
+		array.push_back(static_cast<MoveTracker &&>(moved));
+
+		TS_ASSERT_EQUALS(array.size(), 2u);
+		TS_ASSERT_EQUALS(array[0].value, 1);
+		TS_ASSERT_EQUALS(array[1].value, 2);
+		TS_ASSERT(!copied.movedFrom);
+		TS_ASSERT(moved.movedFrom);
+
+		// Growing the array still works for temporaries
+		array.push_back(MoveTracker(3));
+		TS_ASSERT_EQUALS(array.size(), 3u);
+		TS_ASSERT_EQUALS(array[2].value, 3);
+	}
+
 	void test_copy_constructor() {
 		Common::Array<int> array1;
 
@@ -91,4 +91,40 @@ class BufferedSeekableReadStreamTestSuite : public CxxTest::TestSuite {
 
 		delete &ssrs;
 	}
+
+	void test_borrow() {
+		byte contents[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, 10);
+
+		Common::SeekableReadStream &ssrs
+			= *Common::wrapBufferedSeekableReadStream(&ms, 4, DisposeAfterUse::NO);
+
+		TS_ASSERT_EQUALS(ssrs.readByte(), 0);
+
+		// Data that straddles the end of the buffer gets compacted into it
+		const byte *ptr = ssrs.borrow(4);
+		TS_ASSERT(ptr != nullptr);
+		TS_ASSERT_EQUALS(ptr[0], 1);
+		TS_ASSERT_EQUALS(ptr[3], 4);
+		TS_ASSERT_EQUALS(ssrs.pos(), 5);
+
+		// Larger than the buffer
+		TS_ASSERT(ssrs.borrow(5) == nullptr);
+		TS_ASSERT_EQUALS(ssrs.pos(), 5);
+
+		// Seeking back into the buffered area still works
+		ssrs.seek(-2, SEEK_CUR);
+		TS_ASSERT_EQUALS(ssrs.readByte(), 3);
+
+		ssrs.seek(8, SEEK_SET);
+		TS_ASSERT(ssrs.borrow(3) == nullptr);
+		TS_ASSERT(!ssrs.eos());
+		TS_ASSERT_EQUALS(ssrs.pos(), 8);
+		ptr = ssrs.borrow(2);
+		TS_ASSERT(ptr != nullptr);
+		TS_ASSERT_EQUALS(ptr[1], 9);
+		TS_ASSERT_EQUALS(ssrs.pos(), 10);
+
+		delete &ssrs;
+	}
 };
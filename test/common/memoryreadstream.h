@@ -104,4 +104,52 @@ class MemoryReadStreamTestSuite : public CxxTest::TestSuite {
 		ms.seek(0, SEEK_SET);
 		TS_ASSERT(!ms.eos());
 	}
+
+	void test_borrow() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7 };
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		ms.readByte();
+		const byte *ptr = ms.borrow(4);
+		TS_ASSERT_EQUALS(ptr, contents + 1);
+		TS_ASSERT_EQUALS(ms.pos(), 5);
+
+		// Borrowing past the end fails without touching the stream state
+		TS_ASSERT(ms.borrow(3) == nullptr);
+		TS_ASSERT_EQUALS(ms.pos(), 5);
+		TS_ASSERT(!ms.eos());
+
+		TS_ASSERT_EQUALS(ms.borrow(2), contents + 5);
+		TS_ASSERT_EQUALS(ms.pos(), 7);
+		TS_ASSERT(!ms.eos());
+	}
+
+	void test_memory_reader() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+		Common::MemoryReader mr(contents, sizeof(contents));
+
+		TS_ASSERT_EQUALS(mr.readByte(), 1);
+		TS_ASSERT_EQUALS(mr.readUint16LE(), 0x0302);
+		TS_ASSERT_EQUALS(mr.readUint32BE(), 0x04050607UL);
+		TS_ASSERT_EQUALS(mr.pos(), 7u);
+
+		uint16 values[2];
+		TS_ASSERT(mr.readUint16BEArray(values, 2));
+		TS_ASSERT_EQUALS(values[0], 0x0809);
+		TS_ASSERT_EQUALS(values[1], 0x0A0B);
+		TS_ASSERT_EQUALS(mr.remaining(), 0u);
+		TS_ASSERT(!mr.eos());
+
+		mr.seek(1);
+		uint32 longs[3];
+		TS_ASSERT(!mr.readUint32LEArray(longs, 3));
+		TS_ASSERT(mr.eos());
+		TS_ASSERT_EQUALS(mr.readUint16LE(), 0);
+
+		mr.seek(3);
+		TS_ASSERT(!mr.eos());
+		TS_ASSERT(mr.readUint32LEArray(longs, 2));
+		TS_ASSERT_EQUALS(longs[0], 0x07060504UL);
+		TS_ASSERT_EQUALS(longs[1], 0x0B0A0908UL);
+	}
 };
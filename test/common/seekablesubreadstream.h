@@ -3,6 +3,23 @@
 #include "common/memstream.h"
 #include "common/substream.h"
 
+namespace {
+
+class PrefetchRecordingStream : public Common::MemoryReadStream {
+public:
+	int64 _prefetchOffset;
+	uint32 _prefetchSize;
+
+	PrefetchRecordingStream(const byte *dataPtr, uint32 dataSize) : Common::MemoryReadStream(dataPtr, dataSize), _prefetchOffset(-1), _prefetchSize(0) {}
+
+	void prefetch(int64 offset, uint32 size) override {
+		_prefetchOffset = offset;
+		_prefetchSize = size;
+	}
+};
+
+} // End of anonymous namespace
+
 class SeekableSubReadStreamTestSuite : public CxxTest::TestSuite {
 	public:
 	void test_traverse() {
@@ -70,4 +87,37 @@ class SeekableSubReadStreamTestSuite : public CxxTest::TestSuite {
 		b = ssrs.readByte();
 		TS_ASSERT_EQUALS(b, 1);
 	}
+
+	void test_borrow() {
+		byte contents[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, 10);
+
+		Common::SeekableSubReadStream ssrs(&ms, 2, 8);
+
+		ssrs.seek(1);
+		const byte *ptr = ssrs.borrow(3);
+		TS_ASSERT_EQUALS(ptr, contents + 3);
+		TS_ASSERT_EQUALS(ssrs.pos(), 4);
+
+		// The substream bounds apply, even though the parent has more data
+		TS_ASSERT(ssrs.borrow(3) == nullptr);
+		TS_ASSERT_EQUALS(ssrs.pos(), 4);
+		TS_ASSERT_EQUALS(ssrs.readByte(), 6);
+	}
+
+	void test_prefetch() {
+		byte contents[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		PrefetchRecordingStream ms(contents, 10);
+
+		Common::SeekableSubReadStream ssrs(&ms, 2, 8);
+
+		// Hints are translated to parent offsets and clipped to the substream
+		ssrs.prefetch(1, 100);
+		TS_ASSERT_EQUALS(ms._prefetchOffset, 3);
+		TS_ASSERT_EQUALS(ms._prefetchSize, 5u);
+
+		ms._prefetchOffset = -1;
+		ssrs.prefetch(6, 1);
+		TS_ASSERT_EQUALS(ms._prefetchOffset, -1);
+	}
 };
@@ -0,0 +1,83 @@
+#include <cxxtest/TestSuite.h>
+#include "engines/ultima/ultima8/world/chunk_item_boxes.h"
+
+/**
+ * Test suite for the functions in engines/ultima/ultima8/world/chunk_item_boxes.h
+ *
+ * The items are never dereferenced, so fake pointers are fine here.
+ */
+class U8ChunkItemBoxesTestSuite : public CxxTest::TestSuite {
+	public:
+	U8ChunkItemBoxesTestSuite() {
+	}
+
+	static Ultima::Ultima8::Item *fakeItem(uintptr n) {
+		return reinterpret_cast<Ultima::Ultima8::Item *>(n * 16);
+	}
+
+	void test_order() {
+		Ultima::Ultima8::ChunkItemBoxes boxes;
+		boxes.pushBack(fakeItem(2), 0, 0, 10, 10);
+		boxes.pushFront(fakeItem(1), 0, 0, 10, 10);
+		boxes.pushBack(fakeItem(3), 0, 0, 10, 10);
+		TS_ASSERT_EQUALS(boxes.size(), 3U);
+		TS_ASSERT_EQUALS(boxes.getItem(0), fakeItem(1));
+		TS_ASSERT_EQUALS(boxes.getItem(1), fakeItem(2));
+		TS_ASSERT_EQUALS(boxes.getItem(2), fakeItem(3));
+
+		boxes.remove(fakeItem(2));
+		TS_ASSERT_EQUALS(boxes.size(), 2U);
+		TS_ASSERT_EQUALS(boxes.getItem(0), fakeItem(1));
+		TS_ASSERT_EQUALS(boxes.getItem(1), fakeItem(3));
+
+		boxes.clear();
+		TS_ASSERT_EQUALS(boxes.size(), 0U);
+	}
+
+	void test_overlaps() {
+		Ultima::Ultima8::ChunkItemBoxes boxes;
+		uint8 hits[Ultima::Ultima8::ChunkItemBoxes::kBlockSize];
+
+		boxes.pushBack(fakeItem(1), 0, 0, 10, 10);
+		boxes.pushBack(fakeItem(2), 20, 20, 30, 30);
+		boxes.pushBack(fakeItem(3), 10, 0, 20, 10);
+
+		TS_ASSERT_EQUALS(boxes.overlaps(0, 5, 5, 15, 15, hits), 3U);
+		TS_ASSERT(hits[0]);
+		TS_ASSERT(!hits[1]);
+		TS_ASSERT(hits[2]);
+
+		// Edges only touching don't overlap
+		boxes.overlaps(0, 30, 30, 40, 40, hits);
+		TS_ASSERT(!hits[0]);
+		TS_ASSERT(!hits[1]);
+		TS_ASSERT(!hits[2]);
+
+		TS_ASSERT(boxes.update(fakeItem(1), 25, 25, 35, 35));
+		TS_ASSERT(!boxes.update(fakeItem(4), 0, 0, 1, 1));
+		boxes.overlaps(0, 30, 30, 40, 40, hits);
+		TS_ASSERT(hits[0]);
+		TS_ASSERT(!hits[1]);
+		TS_ASSERT(!hits[2]);
+	}
+
+	void test_blocks() {
+		Ultima::Ultima8::ChunkItemBoxes boxes;
+		uint8 hits[Ultima::Ultima8::ChunkItemBoxes::kBlockSize];
+		const uint n = Ultima::Ultima8::ChunkItemBoxes::kBlockSize + 5;
+
+		for (uint i = 0; i < n; i++)
+			boxes.pushBack(fakeItem(i + 1), i * 10, 0, i * 10 + 10, 10);
+
+		TS_ASSERT_EQUALS(boxes.overlaps(0, 0, 0, 1000, 10, hits),
+		                 Ultima::Ultima8::ChunkItemBoxes::kBlockSize);
+		TS_ASSERT_EQUALS(boxes.overlaps(Ultima::Ultima8::ChunkItemBoxes::kBlockSize,
+		                                0, 0, 1000, 10, hits), 5U);
+		TS_ASSERT(hits[4]);
+
+		// Only the last rectangle reaches x = 365
+		boxes.overlaps(Ultima::Ultima8::ChunkItemBoxes::kBlockSize, 365, 0, 1000, 10, hits);
+		TS_ASSERT(!hits[3]);
+		TS_ASSERT(hits[4]);
+	}
+};
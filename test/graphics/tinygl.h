@@ -0,0 +1,218 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/array.h"
+#include "graphics/tinygl/tinygl.h"
+
+// Draws a mesh with the vertex arrays, then again in immediate mode, and
+// checks both produce the same image. The array paths transform the vertices
+// in blocks and glDrawElements() reuses the vertices shared by triangles,
+// while immediate mode processes one vertex at a time.
+class TinyGLTestSuite : public CxxTest::TestSuite {
+	enum {
+		kWidth = 64,
+		kHeight = 64,
+		kGridSize = 10, // more vertices than the post-transform cache holds
+		kNumVertices = kGridSize * kGridSize,
+		kNumIndices = (kGridSize - 1) * (kGridSize - 1) * 6
+	};
+
+	TGLfloat _coords[kNumVertices * 3];
+	TGLfloat _colors[kNumVertices * 4];
+	TGLfloat _normals[kNumVertices * 3];
+	TGLushort _indices[kNumIndices];
+
+	// A wavy grid which is larger than the view, so that it gets clipped
+	void makeMesh() {
+		for (int y = 0; y < kGridSize; y++) {
+			for (int x = 0; x < kGridSize; x++) {
+				int v = y * kGridSize + x;
+				_coords[v * 3 + 0] = (x - (kGridSize - 1) / 2.0f) * 0.35f;
+				_coords[v * 3 + 1] = (y - (kGridSize - 1) / 2.0f) * 0.35f;
+				_coords[v * 3 + 2] = sinf(x * 0.9f) * cosf(y * 0.7f) * 0.5f;
+				_colors[v * 4 + 0] = (float)x / kGridSize;
+				_colors[v * 4 + 1] = (float)y / kGridSize;
+				_colors[v * 4 + 2] = 1.0f - (float)(x + y) / (2 * kGridSize);
+				_colors[v * 4 + 3] = 1.0f;
+				float nx = -cosf(x * 0.9f) * cosf(y * 0.7f) * 0.45f;
+				float ny = sinf(x * 0.9f) * sinf(y * 0.7f) * 0.35f;
+				float len = sqrtf(nx * nx + ny * ny + 1.0f);
+				_normals[v * 3 + 0] = nx / len;
+				_normals[v * 3 + 1] = ny / len;
+				_normals[v * 3 + 2] = 1.0f / len;
+			}
+		}
+
+		int i = 0;
+		for (int y = 0; y < kGridSize - 1; y++) {
+			for (int x = 0; x < kGridSize - 1; x++) {
+				int v = y * kGridSize + x;
+				_indices[i++] = v;
+				_indices[i++] = v + 1;
+				_indices[i++] = v + kGridSize;
+				_indices[i++] = v + 1;
+				_indices[i++] = v + kGridSize + 1;
+				_indices[i++] = v + kGridSize;
+			}
+		}
+	}
+
+	void beginFrame(bool lighting) {
+		tglClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+		tglClear(TGL_COLOR_BUFFER_BIT | TGL_DEPTH_BUFFER_BIT);
+		tglViewport(0, 0, kWidth, kHeight);
+
+		tglMatrixMode(TGL_PROJECTION);
+		tglLoadIdentity();
+		tglFrustum(-0.5, 0.5, -0.5, 0.5, 1.0, 10.0);
+		tglMatrixMode(TGL_MODELVIEW);
+		tglLoadIdentity();
+		tglTranslatef(0.0f, 0.0f, -2.5f);
+		tglRotatef(30.0f, 1.0f, 0.5f, 0.0f);
+
+		tglEnable(TGL_DEPTH_TEST);
+		if (lighting) {
+			const TGLfloat lightPos[] = { 1.0f, 2.0f, 3.0f, 0.0f };
+			const TGLfloat diffuse[] = { 0.8f, 0.6f, 0.4f, 1.0f };
+			tglLightfv(TGL_LIGHT0, TGL_POSITION, lightPos);
+			tglMaterialfv(TGL_FRONT_AND_BACK, TGL_DIFFUSE, diffuse);
+			tglEnable(TGL_LIGHTING);
+			tglEnable(TGL_LIGHT0);
+		} else {
+			tglDisable(TGL_LIGHTING);
+		}
+	}
+
+	Common::Array<byte> endFrame() {
+		TinyGL::presentBuffer();
+
+		Graphics::Surface surface;
+		TinyGL::getSurfaceRef(surface);
+		const byte *pixels = (const byte *)surface.getPixels();
+		return Common::Array<byte>(pixels, surface.pitch * surface.h);
+	}
+
+	void setArrays(bool lighting) {
+		tglEnableClientState(TGL_VERTEX_ARRAY);
+		tglVertexPointer(3, TGL_FLOAT, 0, _coords);
+		if (lighting) {
+			tglEnableClientState(TGL_NORMAL_ARRAY);
+			tglNormalPointer(TGL_FLOAT, 0, _normals);
+		} else {
+			tglEnableClientState(TGL_COLOR_ARRAY);
+			tglColorPointer(4, TGL_FLOAT, 4 * sizeof(TGLfloat), _colors);
+		}
+	}
+
+	void clearArrays() {
+		tglDisableClientState(TGL_VERTEX_ARRAY);
+		tglDisableClientState(TGL_NORMAL_ARRAY);
+		tglDisableClientState(TGL_COLOR_ARRAY);
+	}
+
+	Common::Array<byte> drawElements(bool lighting) {
+		beginFrame(lighting);
+		setArrays(lighting);
+		tglDrawElements(TGL_TRIANGLES, kNumIndices, TGL_UNSIGNED_SHORT, _indices);
+		clearArrays();
+		return endFrame();
+	}
+
+	Common::Array<byte> drawArrays(bool lighting) {
+		// Unroll the indices, as glDrawArrays() has none
+		TGLfloat coords[kNumIndices * 3];
+		TGLfloat colors[kNumIndices * 4];
+		TGLfloat normals[kNumIndices * 3];
+		for (int i = 0; i < kNumIndices; i++) {
+			int v = _indices[i];
+			memcpy(&coords[i * 3], &_coords[v * 3], 3 * sizeof(TGLfloat));
+			memcpy(&colors[i * 4], &_colors[v * 4], 4 * sizeof(TGLfloat));
+			memcpy(&normals[i * 3], &_normals[v * 3], 3 * sizeof(TGLfloat));
+		}
+
+		beginFrame(lighting);
+		tglEnableClientState(TGL_VERTEX_ARRAY);
+		tglVertexPointer(3, TGL_FLOAT, 0, coords);
+		if (lighting) {
+			tglEnableClientState(TGL_NORMAL_ARRAY);
+			tglNormalPointer(TGL_FLOAT, 0, normals);
+		} else {
+			tglEnableClientState(TGL_COLOR_ARRAY);
+			tglColorPointer(4, TGL_FLOAT, 4 * sizeof(TGLfloat), colors);
+		}
+		tglDrawArrays(TGL_TRIANGLES, 0, kNumIndices);
+		clearArrays();
+		return endFrame();
+	}
+
+	Common::Array<byte> drawImmediate(bool lighting) {
+		beginFrame(lighting);
+		tglBegin(TGL_TRIANGLES);
+		for (int i = 0; i < kNumIndices; i++) {
+			int v = _indices[i];
+			if (lighting)
+				tglNormal3f(_normals[v * 3 + 0], _normals[v * 3 + 1], _normals[v * 3 + 2]);
+			else
+				tglColor4f(_colors[v * 4 + 0], _colors[v * 4 + 1], _colors[v * 4 + 2], _colors[v * 4 + 3]);
+			tglVertex3f(_coords[v * 3 + 0], _coords[v * 3 + 1], _coords[v * 3 + 2]);
+		}
+		tglEnd();
+		return endFrame();
+	}
+
+	static int countDifferences(const Common::Array<byte> &a, const Common::Array<byte> &b) {
+		int differences = 0;
+		for (uint i = 0; i < a.size(); i++) {
+			if (a[i] != b[i])
+				differences++;
+		}
+		return differences;
+	}
+
+	static bool isBlank(const Common::Array<byte> &image) {
+		for (uint i = 0; i < image.size(); i++) {
+			if (image[i] != 0)
+				return false;
+		}
+		return true;
+	}
+
+public:
+	void setUp() {
+		makeMesh();
+		TinyGL::createContext(kWidth, kHeight, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), 256, false, false);
+	}
+
+	void tearDown() {
+		TinyGL::destroyContext();
+	}
+
+	void test_draw_elements_colors() {
+		Common::Array<byte> immediate = drawImmediate(false);
+		Common::Array<byte> elements = drawElements(false);
+		TS_ASSERT(!isBlank(immediate));
+		TS_ASSERT_EQUALS(elements.size(), immediate.size());
+		TS_ASSERT_EQUALS(countDifferences(elements, immediate), 0);
+	}
+
+	void test_draw_elements_lighting() {
+		Common::Array<byte> immediate = drawImmediate(true);
+		Common::Array<byte> elements = drawElements(true);
+		TS_ASSERT(!isBlank(immediate));
+		TS_ASSERT_EQUALS(elements.size(), immediate.size());
+		TS_ASSERT_EQUALS(countDifferences(elements, immediate), 0);
+	}
+
+	void test_draw_arrays_colors() {
+		Common::Array<byte> immediate = drawImmediate(false);
+		Common::Array<byte> arrays = drawArrays(false);
+		TS_ASSERT_EQUALS(arrays.size(), immediate.size());
+		TS_ASSERT_EQUALS(countDifferences(arrays, immediate), 0);
+	}
+
+	void test_draw_arrays_lighting() {
+		Common::Array<byte> immediate = drawImmediate(true);
+		Common::Array<byte> arrays = drawArrays(true);
+		TS_ASSERT_EQUALS(arrays.size(), immediate.size());
+		TS_ASSERT_EQUALS(countDifferences(arrays, immediate), 0);
+	}
+};
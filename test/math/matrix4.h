@@ -0,0 +1,102 @@
+#include <cxxtest/TestSuite.h>
+
+#include "math/matrix4.h"
+
+class Matrix4TestSuite : public CxxTest::TestSuite {
+	// An arbitrary invertible matrix, with a rotation, a scale and a translation
+	// as well as a projective last row.
+	static Math::Matrix4 makeMatrix(float seed) {
+		Math::Matrix4 m;
+		float *d = m.getData();
+		for (int i = 0; i < 16; ++i)
+			d[i] = sinf(seed + i * 1.7f) * 3.0f;
+		d[0] += 10.0f;
+		d[5] += 10.0f;
+		d[10] += 10.0f;
+		d[15] += 10.0f;
+		return m;
+	}
+
+	static bool isNear(float a, float b) {
+		return fabs(a - b) <= 0.0001f * MAX(1.0f, fabs(a));
+	}
+
+public:
+	void test_multiply() {
+		for (int n = 0; n < 8; ++n) {
+			Math::Matrix4 a = makeMatrix(n);
+			Math::Matrix4 b = makeMatrix(n + 0.5f);
+			Math::Matrix4 r = a * b;
+
+			for (int i = 0; i < 4; ++i) {
+				for (int j = 0; j < 4; ++j) {
+					float expected = 0.0f;
+					for (int k = 0; k < 4; ++k)
+						expected += a(i, k) * b(k, j);
+					TS_ASSERT(isNear(r(i, j), expected));
+				}
+			}
+		}
+	}
+
+	void test_transformVector4d() {
+		for (int n = 0; n < 8; ++n) {
+			Math::Matrix4 m = makeMatrix(n);
+			Math::Vector4d v(n + 1.0f, -2.0f * n, 0.5f, 1.0f);
+			Math::Vector4d r = m.transform(v);
+
+			for (int j = 0; j < 4; ++j) {
+				float expected = 0.0f;
+				for (int k = 0; k < 4; ++k)
+					expected += v.getValue(k) * m(k, j);
+				TS_ASSERT(isNear(r.getValue(j), expected));
+			}
+		}
+	}
+
+	void test_transformVector3d() {
+		for (int n = 0; n < 8; ++n) {
+			Math::Matrix4 m = makeMatrix(n);
+			for (int trans = 0; trans < 2; ++trans) {
+				Math::Vector3d v(n + 1.0f, -2.0f * n, 0.5f);
+				Math::Vector3d r(v);
+				m.transform(&r, trans);
+
+				for (int i = 0; i < 3; ++i) {
+					float expected = trans ? m(i, 3) : 0.0f;
+					for (int k = 0; k < 3; ++k)
+						expected += m(i, k) * v.getValue(k);
+					TS_ASSERT(isNear(r.getValue(i), expected));
+				}
+			}
+		}
+	}
+
+	void test_inverse() {
+		for (int n = 0; n < 8; ++n) {
+			Math::Matrix4 m = makeMatrix(n);
+			Math::Matrix4 inv(m);
+			TS_ASSERT(inv.inverse());
+
+			Math::Matrix4 r = m * inv;
+			for (int i = 0; i < 4; ++i) {
+				for (int j = 0; j < 4; ++j)
+					TS_ASSERT(fabs(r(i, j) - (i == j ? 1.0f : 0.0f)) < 0.0001f);
+			}
+		}
+
+		// A translation has a known inverse
+		Math::Matrix4 t;
+		t.setPosition(Math::Vector3d(1.0f, 2.0f, 3.0f));
+		TS_ASSERT(t.inverse());
+		TS_ASSERT(t.getPosition() == Math::Vector3d(-1.0f, -2.0f, -3.0f));
+
+		// A singular matrix is left untouched
+		Math::Matrix4 s = makeMatrix(1);
+		for (int j = 0; j < 4; ++j)
+			s(3, j) = s(2, j);
+		Math::Matrix4 copy(s);
+		TS_ASSERT(!s.inverse());
+		TS_ASSERT(s == copy);
+	}
+};
@@ -101,4 +101,26 @@ public:
 		TS_ASSERT(r.z() == -q.z());
 		TS_ASSERT(r.w() == q.w());
 	}
+
+	void test_multiply() {
+		Math::Quaternion q(0.1f, -0.7f, 0.3f, 0.6f);
+		Math::Quaternion r(-0.5f, 0.2f, 0.8f, -0.4f);
+		Math::Quaternion p = q * r;
+
+		// Compare against the Hamilton product written out
+		TS_ASSERT(fabs(p.x() - (q.w() * r.x() + q.x() * r.w() + q.y() * r.z() - q.z() * r.y())) < 0.0001f);
+		TS_ASSERT(fabs(p.y() - (q.w() * r.y() - q.x() * r.z() + q.y() * r.w() + q.z() * r.x())) < 0.0001f);
+		TS_ASSERT(fabs(p.z() - (q.w() * r.z() + q.x() * r.y() - q.y() * r.x() + q.z() * r.w())) < 0.0001f);
+		TS_ASSERT(fabs(p.w() - (q.w() * r.w() - q.x() * r.x() - q.y() * r.y() - q.z() * r.z())) < 0.0001f);
+
+		// The product of unit quaternions rotates like the product of their matrices
+		q.normalize();
+		r.normalize();
+		Math::Matrix4 m = (q * r).toMatrix();
+		Math::Matrix4 n = q.toMatrix() * r.toMatrix();
+		for (int i = 0; i < 3; ++i) {
+			for (int j = 0; j < 3; ++j)
+				TS_ASSERT(fabs(m(i, j) - n(i, j)) < 0.0001f);
+		}
+	}
 };